@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <meta/base/core/Clock.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Timer.hpp>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    constexpr size_t Reads = 2000000;
+    constexpr int Runs = 5;
+    constexpr int Sleeps = 5; // timer samples per sleep length
+
+    double rounded(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 100.0 + 0.5)) / 100.0;
+    }
+
+    // Best of Runs, in ns per now()
+    template <typename Clock> double readCost()
+    {
+        double best = 1e300;
+        int64_t total = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < Reads; ++i)
+                total += Clock::now().time_since_epoch().count();
+            double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, nanos / Reads);
+        }
+        if (total == 42)
+            meta::println("unlikely");
+        return best;
+    }
+
+    // Largest difference, in microseconds, between a Timer on Clock and steady_clock over the same sleep
+    template <typename Clock> double timerError(std::chrono::milliseconds sleep)
+    {
+        double worst = 0.0;
+        for (int i = 0; i < Sleeps; ++i)
+        {
+            meta::Timer<meta::Microseconds, Clock> timer;
+            auto start = std::chrono::steady_clock::now();
+            std::this_thread::sleep_for(sleep);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            double reference = std::chrono::duration<double, std::micro>(elapsed).count();
+            worst = std::max(worst, std::abs(timer.elapsed() - reference));
+        }
+        return worst;
+    }
+} // namespace
+
+// Cost of the first TscClock::now() (which only starts calibration) and how long calibration takes, the cost of one
+// read for each clock, and how far a Timer on each clock strays from steady_clock over 1, 10 and 100 ms sleeps
+int main()
+{
+    auto start = std::chrono::steady_clock::now();
+    static_cast<void>(meta::TscClock::now());
+    double firstRead = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    meta::TscClock::calibrate();
+    double calibrated = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    meta::println<"first TscClock::now(): {} us, calibration done after {} ms, cycle counter {}">(
+        rounded(firstRead), rounded(calibrated), meta::TscClock::usesCycleCounter() ? "in use" : "unusable");
+
+    meta::println<"now() cost: steady_clock {} ns, system_clock {} ns, high_resolution_clock {} ns, TscClock {} ns">(
+        rounded(readCost<std::chrono::steady_clock>()), rounded(readCost<std::chrono::system_clock>()),
+        rounded(readCost<std::chrono::high_resolution_clock>()), rounded(readCost<meta::TscClock>()));
+
+    for (auto sleep : { std::chrono::milliseconds(1), std::chrono::milliseconds(10), std::chrono::milliseconds(100) })
+    {
+        meta::println<"Timer error over {} ms sleeps: steady_clock {} us, TscClock {} us">(
+            sleep.count(), rounded(timerError<std::chrono::steady_clock>(sleep)),
+            rounded(timerError<meta::TscClock>(sleep)));
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <meta/base/core/ConcurrentSignal.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Signal.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int EmitsPerThread = 200000;
+    constexpr int SlotCount = 8;
+
+    struct Result
+    {
+        int64_t emitsPerSecond;
+        int64_t churn;        // connect/disconnect pairs completed by the writer meanwhile
+        bool correct = false; // every emit reached every permanent slot, checked by the caller
+    };
+
+    // emitterCount threads call emit while one more thread keeps calling reconnect (connect a slot, disconnect it)
+    template <typename Emit, typename Reconnect> Result run(int emitterCount, Emit&& emit, Reconnect&& reconnect)
+    {
+        std::atomic<bool> stop{ false };
+        int64_t churn = 0;
+        std::thread writer(
+            [&]
+            {
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    reconnect();
+                    ++churn;
+                }
+            });
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> emitters;
+        for (int t = 0; t < emitterCount; ++t)
+            emitters.emplace_back(
+                [&]
+                {
+                    for (int i = 0; i < EmitsPerThread; ++i)
+                        emit();
+                });
+        for (auto& thread : emitters)
+            thread.join();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        stop.store(true, std::memory_order_relaxed);
+        writer.join();
+        return { static_cast<int64_t>(emitterCount * EmitsPerThread / seconds), churn };
+    }
+} // namespace
+
+// Emits from 1-8 threads while another thread connects and disconnects slots, once through ConcurrentSignal and
+// once through a Signal guarded by a mutex, the way a Signal has to be shared between threads
+int main()
+{
+    for (int emitterCount : { 1, 2, 4, 8 })
+    {
+        int64_t expected = int64_t(emitterCount) * EmitsPerThread * SlotCount;
+
+        std::atomic<int64_t> concurrentTotal{ 0 };
+        meta::ConcurrentSignal<int> concurrent;
+        std::vector<meta::ConcurrentSignal<int>::Connection> concurrentSlots;
+        for (int i = 0; i < SlotCount; ++i)
+            concurrentSlots.push_back(concurrent.connect(
+                [&](int value) { concurrentTotal.fetch_add(value, std::memory_order_relaxed); }));
+
+        Result lockFree = run(
+            emitterCount, [&] { concurrent.emit(1); },
+            [&] { concurrent.connect([](int) {}).disconnect(); });
+        lockFree.correct = concurrentTotal.load() == expected;
+
+        std::atomic<int64_t> lockedTotal{ 0 };
+        std::mutex mutex;
+        meta::Signal<int> locked;
+        for (int i = 0; i < SlotCount; ++i)
+            locked.connect([&](int value) { lockedTotal.fetch_add(value, std::memory_order_relaxed); });
+
+        Result mutexed = run(
+            emitterCount,
+            [&]
+            {
+                std::lock_guard lock(mutex);
+                locked.emit(1);
+            },
+            [&]
+            {
+                std::lock_guard lock(mutex);
+                locked.connect([](int) {}).disconnect();
+            });
+        mutexed.correct = lockedTotal.load() == expected;
+
+        meta::println<"{} emitters: ConcurrentSignal {} emits/s ({} reconnects{}), Signal+mutex {} emits/s ({} "
+                      "reconnects{})">(emitterCount, lockFree.emitsPerSecond, lockFree.churn,
+                                       lockFree.correct ? "" : ", WRONG TOTAL", mutexed.emitsPerSecond, mutexed.churn,
+                                       mutexed.correct ? "" : ", WRONG TOTAL");
+        if (!lockFree.correct || !mutexed.correct)
+            return 1;
+    }
+    return 0;
+}
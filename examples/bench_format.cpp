@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/String.hpp>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace
+{
+    // meta::format as it was before Formatter<T>: every argument that isn't a string goes through its own
+    // std::ostringstream, and the pieces are concatenated
+    namespace legacy
+    {
+        template <typename T> meta::String<> to_meta_string(const T& value)
+        {
+            if constexpr (std::is_same_v<T, meta::String<>>)
+            {
+                return value;
+            }
+            else if constexpr (std::is_convertible_v<T, std::string>)
+            {
+                return meta::String<>(value);
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << value;
+                return meta::String<>(oss.str());
+            }
+        }
+
+        template <typename... Args> meta::String<> format(Args&&... args)
+        {
+            meta::String<> result;
+            ((result += legacy::to_meta_string(std::forward<Args>(args))), ...);
+            return result;
+        }
+    } // namespace legacy
+
+    constexpr size_t Calls = 200000;
+    constexpr int Runs = 10;
+
+    // Best of Runs, in ns per call; call returns the formatted size so the work can't be optimized away
+    template <typename Call> double measure(Call&& call)
+    {
+        double best = 1e300;
+        size_t total = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < Calls; ++i)
+                total += call(i);
+            double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, nanos / Calls);
+        }
+        if (total == 42)
+            meta::println("unlikely");
+        return best;
+    }
+
+    double round(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 10.0 + 0.5)) / 10.0;
+    }
+
+    template <typename Legacy, typename Current> void compare(std::string_view what, Legacy&& legacy, Current&& current)
+    {
+        meta::println<"{}: {} -> {} ns per call">(what, round(measure(legacy)), round(measure(current)));
+    }
+} // namespace
+
+// ns per meta::format call for common argument mixes, through the ostringstream based format it replaced and through
+// Formatter<T>, plus the compile-time pattern form
+int main()
+{
+    const meta::String<> name("settings.ini");
+
+    compare(
+        "one int               ", [](size_t i) { return legacy::format(static_cast<int>(i)).size(); },
+        [](size_t i) { return meta::format(static_cast<int>(i)).size(); });
+    compare(
+        "one double            ", [](size_t i) { return legacy::format(static_cast<double>(i) * 0.25).size(); },
+        [](size_t i) { return meta::format(static_cast<double>(i) * 0.25).size(); });
+    compare(
+        "strings only          ", [&](size_t) { return legacy::format("loading ", name, " from disk").size(); },
+        [&](size_t) { return meta::format("loading ", name, " from disk").size(); });
+    compare(
+        "key=value line        ", [](size_t i) { return legacy::format("key", i, "=value", i, "\n").size(); },
+        [](size_t i) { return meta::format("key", i, "=value", i, "\n").size(); });
+    compare(
+        "mixed int/double/bool ",
+        [](size_t i) { return legacy::format("x=", i, " y=", static_cast<double>(i) / 3, " ok=", i % 2 == 0).size(); },
+        [](size_t i) { return meta::format("x=", i, " y=", static_cast<double>(i) / 3, " ok=", i % 2 == 0).size(); });
+    compare(
+        "pattern \"x={} y={}\"   ", [](size_t i) { return legacy::format("x=", i, " y=", i * 3).size(); },
+        [](size_t i) { return meta::format<"x={} y={}">(i, i * 3).size(); });
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Hash.hpp>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr size_t BytesPerMeasurement = 64 * 1024 * 1024; // key bytes hashed per timed loop
+    constexpr size_t LookupsPerMeasurement = 2000000;
+    constexpr int Runs = 5;
+
+    double round(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 100.0 + 0.5)) / 100.0;
+    }
+
+    // Best of Runs, in ns per hash; the key's first byte changes every call so the hash can't be hoisted
+    template <typename Policy> double hashCost(size_t length)
+    {
+        std::string key(length, 'k');
+        size_t calls = std::max<size_t>(1000, BytesPerMeasurement / length);
+        double best = 1e300;
+        size_t total = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < calls; ++i)
+            {
+                key[0] = static_cast<char>(i);
+                total += Policy::hash(key);
+            }
+            double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, nanos / static_cast<double>(calls));
+        }
+        if (total == 42)
+            meta::println("unlikely");
+        return best;
+    }
+
+    // Names shaped like settings and atom keys: "section<n>.key<n>"
+    std::vector<std::string> makeKeys(size_t count, std::string_view prefix)
+    {
+        std::vector<std::string> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            keys.push_back(std::string(prefix) + std::to_string(i % 97) + ".key" + std::to_string(i));
+        return keys;
+    }
+
+    // Best of Runs, in ns per find() through string_view (transparent lookup), in a pseudo-random key order
+    template <typename Policy>
+    double lookupCost(const std::vector<std::string>& keys, const std::vector<std::string>& probes)
+    {
+        std::unordered_map<std::string, size_t, meta::StringHash<Policy>, std::equal_to<>> map;
+        map.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i)
+            map.emplace(keys[i], i);
+
+        double best = 1e300;
+        size_t found = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            uint64_t state = 0x9E3779B97F4A7C15ull;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < LookupsPerMeasurement; ++i)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                auto it = map.find(std::string_view(probes[state % probes.size()]));
+                found += it != map.end() ? it->second : 1;
+            }
+            double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, nanos / static_cast<double>(LookupsPerMeasurement));
+        }
+        if (found == 42)
+            meta::println("unlikely");
+        return best;
+    }
+} // namespace
+
+// Hash cost per key length and unordered_map lookup latency, hits and misses, for WyHashPolicy and StdHashPolicy
+int main()
+{
+    for (size_t length : { 4, 8, 16, 32, 64, 256, 4096 })
+    {
+        double wy = hashCost<meta::WyHashPolicy>(length);
+        double standard = hashCost<meta::StdHashPolicy>(length);
+        meta::println<"hash {} bytes (wyhash / std::hash): {} / {} ns, {} / {} GB/s">(
+            length, round(wy), round(standard), round(static_cast<double>(length) / wy),
+            round(static_cast<double>(length) / standard));
+    }
+
+    for (size_t count : { 1000, 100000, 1000000 })
+    {
+        std::vector<std::string> keys = makeKeys(count, "section");
+        std::vector<std::string> misses = makeKeys(count, "missing");
+        double hitWy = lookupCost<meta::WyHashPolicy>(keys, keys);
+        double hitStandard = lookupCost<meta::StdHashPolicy>(keys, keys);
+        double missWy = lookupCost<meta::WyHashPolicy>(keys, misses);
+        double missStandard = lookupCost<meta::StdHashPolicy>(keys, misses);
+        meta::println<"{} keys, find hit (wyhash / std::hash): {} / {} ns, miss: {} / {} ns">(
+            count, round(hitWy), round(hitStandard), round(missWy), round(missStandard));
+    }
+    return 0;
+}
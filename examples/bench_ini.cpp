@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <meta/base/core/Atom.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/String.hpp>
+#include <meta/base/core/StringBuilder.hpp>
+#include <meta/base/serialization/INI.hpp>
+#include <new>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    size_t allocations = 0; // operator new calls since start
+} // namespace
+
+// Counting replacements; kept out of line so g++ doesn't pair an inlined malloc with the delete at each call site
+META_NOINLINE void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+META_NOINLINE void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+META_NOINLINE void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    constexpr size_t Sections = 50;
+    constexpr size_t KeysPerSection = 40;
+    constexpr int Runs = 20;
+
+    // INI::parse as it was before StringView: the content is copied into an istringstream and every line into a
+    // std::string and then a String<>, and key and value are trimmed copies
+    void legacyParse(meta::INI::Data& data, const meta::String<>& content)
+    {
+        data.clear();
+        meta::Atom currentSection;
+
+        std::istringstream iss(content.toString());
+        std::string rawLine;
+
+        while (std::getline(iss, rawLine))
+        {
+            meta::String<> line(rawLine);
+            line.trim();
+
+            if (line.empty() || line[0] == ';' || line[0] == '#')
+                continue;
+
+            if (line.front() == '[' && line.back() == ']')
+            {
+                currentSection = meta::Atom(line.substr(1, line.size() - 2).trim());
+            }
+            else
+            {
+                auto eqPos = line.find('=');
+                if (eqPos != meta::String<>::npos)
+                {
+                    meta::String<> key = line.substr(0, eqPos).trim();
+                    meta::String<> value = line.substr(eqPos + 1).trim();
+                    data[currentSection][meta::Atom(key)] = value;
+                }
+            }
+        }
+    }
+
+    // Sections of "key = value" lines with a comment line every ten keys, the shape of a settings file; padding
+    // lengthens every value
+    meta::String<> makeDocument(size_t padding, size_t& lineCount)
+    {
+        meta::StringBuilder builder;
+        lineCount = 0;
+        for (size_t s = 0; s < Sections; ++s)
+        {
+            builder.appendFormat("[section", s, "]\n");
+            ++lineCount;
+            for (size_t k = 0; k < KeysPerSection; ++k)
+            {
+                if (k % 10 == 0)
+                {
+                    builder.appendFormat("; settings ", k, " to ", k + 9, "\n");
+                    ++lineCount;
+                }
+                builder.appendFormat("  key", k, " = value ", k, " of section ", s, " ");
+                builder.append(std::string(padding, 'x'));
+                builder += '\n';
+                ++lineCount;
+            }
+            builder += '\n';
+            ++lineCount;
+        }
+        return builder.toString();
+    }
+
+    struct Cost
+    {
+        double megabytesPerSecond = 0.0; // best of Runs
+        size_t allocations = 0;          // per parse, after the first one interned every name
+    };
+
+    template <typename Parse> Cost measure(size_t bytes, Parse&& parse)
+    {
+        parse();
+        Cost cost;
+        for (int run = 0; run < Runs; ++run)
+        {
+            size_t before = allocations;
+            auto start = std::chrono::steady_clock::now();
+            parse();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            cost.megabytesPerSecond = std::max(cost.megabytesPerSecond, static_cast<double>(bytes) / seconds / 1e6);
+            cost.allocations = allocations - before;
+        }
+        return cost;
+    }
+
+    double round(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 10.0 + 0.5)) / 10.0;
+    }
+} // namespace
+
+// Parses a settings document with the istringstream based INI::parse it replaced and with the StringView based one,
+// reporting throughput and heap allocations per parse
+int main()
+{
+    for (size_t padding : { 0, 200 })
+    {
+        size_t lineCount = 0;
+        meta::String<> document = makeDocument(padding, lineCount);
+
+        meta::INI::Data legacyData;
+        Cost legacy = measure(document.size(), [&] { legacyParse(legacyData, document); });
+        meta::INI ini;
+        Cost current = measure(document.size(), [&] { ini.parse(document); });
+
+        if (!ini.has("section7", "key12") || legacyData.size() != Sections)
+            meta::errorln("parsers disagree about the document");
+
+        meta::println<"{} bytes, {} lines, {} keys, values padded by {}">(document.size(), lineCount,
+                                                                          Sections * KeysPerSection, padding);
+        meta::println<"  istringstream parse: {} MB/s, {} allocations per parse">(round(legacy.megabytesPerSecond),
+                                                                                legacy.allocations);
+        meta::println<"  StringView parse:    {} MB/s, {} allocations per parse">(round(current.megabytesPerSecond),
+                                                                                current.allocations);
+    }
+    return 0;
+}
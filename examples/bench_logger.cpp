@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <meta/base/app/Logger.hpp>
+#include <meta/base/core/Console.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t Producers = 8;
+    constexpr size_t LinesPerProducer = 100000;
+
+    struct Result
+    {
+        int64_t p50 = 0;  // per-call latency percentiles, ns
+        int64_t p99 = 0;
+        int64_t p999 = 0;
+        int64_t max = 0;
+        int64_t linesPerSecond = 0; // until every line reached the file
+    };
+
+    // Every producer logs LinesPerProducer lines to a file sink, timing each call; the wall time includes the flush
+    Result run(bool async)
+    {
+        const std::filesystem::path file = std::filesystem::temp_directory_path() / "meta_bench_logger.log";
+        std::filesystem::remove(file);
+
+        std::vector<std::vector<int64_t>> latencies(Producers, std::vector<int64_t>(LinesPerProducer));
+        double seconds = 0.0;
+        {
+            meta::Logger logger;
+            logger.clearSinks();
+            logger.setFile(meta::Path(std::string_view(file.string())));
+            if (async)
+                logger.enableAsync();
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < Producers; ++t)
+                threads.emplace_back(
+                    [&logger, &samples = latencies[t], t]
+                    {
+                        for (size_t i = 0; i < LinesPerProducer; ++i)
+                        {
+                            auto before = std::chrono::steady_clock::now();
+                            logger.info("request ", i, " from producer ", t, " handled");
+                            samples[i] = (std::chrono::steady_clock::now() - before).count();
+                        }
+                    });
+            for (auto& thread : threads)
+                thread.join();
+            logger.flush();
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        std::filesystem::remove(file);
+
+        std::vector<int64_t> all;
+        all.reserve(Producers * LinesPerProducer);
+        for (auto& samples : latencies)
+            all.insert(all.end(), samples.begin(), samples.end());
+        std::sort(all.begin(), all.end());
+        auto percentile = [&](double p) { return all[static_cast<size_t>(p * static_cast<double>(all.size() - 1))]; };
+
+        Result result;
+        result.p50 = percentile(0.5);
+        result.p99 = percentile(0.99);
+        result.p999 = percentile(0.999);
+        result.max = all.back();
+        result.linesPerSecond = static_cast<int64_t>(static_cast<double>(all.size()) / seconds);
+        return result;
+    }
+} // namespace
+
+// Per-call latency of Logger::info from 8 threads writing to a file, in sync mode (formatting and writing on the
+// caller) and in async mode (the caller only formats and queues)
+int main()
+{
+    meta::println<"{} producers, {} lines each, {} hardware threads">(Producers, LinesPerProducer,
+                                                                       std::thread::hardware_concurrency());
+    for (bool async : { false, true })
+    {
+        Result result = run(async);
+        meta::println<"{}: p50 {} ns, p99 {} ns, p99.9 {} ns, max {} us, {} lines/s">(
+            async ? "async" : "sync ", result.p50, result.p99, result.p999, result.max / 1000, result.linesPerSecond);
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/String.hpp>
+#include <meta/base/core/StringBuilder.hpp>
+
+namespace
+{
+    constexpr size_t DocumentSize = 10 * 1024 * 1024;
+    constexpr int Runs = 5;
+
+    // Best of Runs, in microseconds; build returns the document size so the work can't be optimized away
+    template <typename Build> int64_t measure(Build&& build, size_t& size)
+    {
+        int64_t best = INT64_MAX;
+        for (int run = 0; run < Runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            size = build();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min<int64_t>(best, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        }
+        return best;
+    }
+} // namespace
+
+// Builds a 10 MB settings document of "key<i>=value<i>" lines the way INI::save used to (appending meta::format
+// results to one String<>) and with StringBuilder, with and without flattening it afterwards
+int main()
+{
+    size_t oldSize = 0, builderSize = 0, flatSize = 0;
+
+    int64_t oldTime = measure(
+        [&]
+        {
+            meta::String<> content;
+            for (size_t i = 0; content.size() < DocumentSize; ++i)
+                content += meta::format("key", i, "=value", i, "\n");
+            return content.size();
+        },
+        oldSize);
+
+    int64_t builderTime = measure(
+        [&]
+        {
+            meta::StringBuilder content;
+            for (size_t i = 0; content.size() < DocumentSize; ++i)
+                content.appendFormat("key", i, "=value", i, "\n");
+            return content.size();
+        },
+        builderSize);
+
+    int64_t flatTime = measure(
+        [&]
+        {
+            meta::StringBuilder content;
+            for (size_t i = 0; content.size() < DocumentSize; ++i)
+                content.appendFormat("key", i, "=value", i, "\n");
+            return content.toString().size();
+        },
+        flatSize);
+
+    meta::println<"String<> += format:      {} bytes in {} us">(oldSize, oldTime);
+    meta::println<"StringBuilder:           {} bytes in {} us">(builderSize, builderTime);
+    meta::println<"StringBuilder+toString:  {} bytes in {} us">(flatSize, flatTime);
+    return 0;
+}
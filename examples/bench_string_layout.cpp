@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/String.hpp>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    size_t allocations = 0; // operator new calls since start
+} // namespace
+
+// Counting replacements; kept out of line so g++ doesn't pair an inlined malloc with the delete at each call site
+META_NOINLINE void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+META_NOINLINE void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+META_NOINLINE void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    // String as it was before the union layout: size, an N character array and a std::string for anything longer,
+    // reduced to what the benchmark exercises
+    template <size_t N> class LegacyString
+    {
+    public:
+        LegacyString(std::string_view sv)
+        {
+            if (sv.size() <= N)
+            {
+                m_size = sv.size();
+                std::copy_n(sv.data(), m_size, m_buffer.data());
+            }
+            else
+                m_runtime = std::make_unique<std::string>(sv);
+        }
+
+        LegacyString(const LegacyString& other) : m_size(other.m_size)
+        {
+            if (other.m_runtime)
+                m_runtime = std::make_unique<std::string>(*other.m_runtime);
+            else
+                std::copy_n(other.m_buffer.data(), m_size, m_buffer.data());
+        }
+
+        LegacyString& operator+=(std::string_view sv)
+        {
+            if (m_runtime || m_size + sv.size() > N)
+            {
+                if (!m_runtime)
+                    m_runtime = std::make_unique<std::string>(std::string(m_buffer.data(), m_size));
+                m_runtime->append(sv.data(), sv.size());
+            }
+            else
+            {
+                std::copy_n(sv.data(), sv.size(), m_buffer.data() + m_size);
+                m_size += sv.size();
+                m_buffer[m_size] = '\0';
+            }
+            return *this;
+        }
+
+        size_t size() const noexcept
+        {
+            return m_runtime ? m_runtime->size() : m_size;
+        }
+
+    private:
+        size_t m_size = 0;
+        std::array<char, N> m_buffer{};
+        std::unique_ptr<std::string> m_runtime{};
+    };
+
+    constexpr size_t Count = 10000; // strings per measurement
+    constexpr int Runs = 20;
+
+    struct Cost
+    {
+        double nanos = 1e300;    // per string, best of Runs
+        double allocations = 0; // per string
+    };
+
+    // Best of Runs; work returns a size so the strings can't be optimized away
+    template <typename Work> Cost measure(Work&& work)
+    {
+        Cost cost;
+        size_t total = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            size_t before = allocations;
+            auto start = std::chrono::steady_clock::now();
+            total += work();
+            double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            cost.nanos = std::min(cost.nanos, nanos / Count);
+            cost.allocations = static_cast<double>(allocations - before) / Count;
+        }
+        if (total == 42)
+            meta::println("unlikely");
+        return cost;
+    }
+
+    // Constructs Count strings of the given length and copies each one
+    template <typename StringType> Cost constructAndCopy(size_t length)
+    {
+        std::string text(length, 'x');
+        return measure(
+            [&]
+            {
+                std::vector<StringType> strings;
+                std::vector<StringType> copies;
+                strings.reserve(Count);
+                copies.reserve(Count);
+                size_t size = 0;
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    strings.emplace_back(std::string_view(text));
+                    copies.push_back(strings.back());
+                    size += copies.back().size();
+                }
+                return size;
+            });
+    }
+
+    // Grows each of Count strings to the given length in 8 character pieces
+    template <typename StringType> Cost appendPieces(size_t length)
+    {
+        return measure(
+            [&]
+            {
+                size_t size = 0;
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    StringType s(std::string_view{});
+                    while (s.size() < length)
+                        s += "abcdefgh";
+                    size += s.size();
+                }
+                return size;
+            });
+    }
+
+    double round(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 10.0 + 0.5)) / 10.0;
+    }
+
+    template <size_t N> void compare()
+    {
+        meta::println<"String<{}>: sizeof {} -> {} bytes">(N, sizeof(LegacyString<N>), sizeof(meta::String<N>));
+
+        auto report = [](std::string_view what, size_t length, Cost legacy, Cost current)
+        {
+            meta::println<"  {} {} chars (old -> new): {} -> {} ns, {} -> {} allocations per string">(
+                what, length, round(legacy.nanos), round(current.nanos), round(legacy.allocations),
+                round(current.allocations));
+        };
+        for (size_t length : { N / 2, N * 2 })
+            report("construct+copy", length, constructAndCopy<LegacyString<N>>(length),
+                   constructAndCopy<meta::String<N>>(length));
+        report("append to", N * 4, appendPieces<LegacyString<N>>(N * 4), appendPieces<meta::String<N>>(N * 4));
+    }
+} // namespace
+
+// Compares object size, allocations and time of the union String layout against the size/array/std::string layout
+// it replaced, for strings that fit inline, strings that don't, and strings grown by appending
+int main()
+{
+    compare<16>();
+    compare<32>();
+    compare<128>();
+    compare<256>();
+    return 0;
+}
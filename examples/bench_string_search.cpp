@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/StringSearch.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr size_t BytesPerMeasurement = 64 * 1024 * 1024; // haystack bytes scanned per timed loop
+    constexpr int Runs = 5;
+    constexpr std::string_view Needle = "zqxjkv";
+
+    using Search = size_t (*)(std::string_view haystack);
+
+    // Lowercase letters from a fixed xorshift seed, ending in Needle followed by '#', so both searches scan it all
+    std::string makeHaystack(size_t size)
+    {
+        std::string text(size, ' ');
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (char& c : text)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            c = static_cast<char>('a' + state % 26);
+        }
+        text.replace(size - Needle.size() - 1, Needle.size(), Needle);
+        text.back() = '#';
+        return text;
+    }
+
+    // Best of Runs, in GB/s; the found offsets are summed so the searches can't be optimized away
+    double measure(std::string_view haystack, Search search)
+    {
+        size_t repeats = std::max<size_t>(1, BytesPerMeasurement / haystack.size());
+        double best = 0.0;
+        size_t total = 0;
+        for (int run = 0; run < Runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < repeats; ++i)
+                total += search(haystack);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = std::max(best, static_cast<double>(repeats * haystack.size()) / seconds / 1e9);
+        }
+        if (total == 42)
+            meta::println("unlikely");
+        return best;
+    }
+
+    double round(double value)
+    {
+        return static_cast<double>(static_cast<int64_t>(value * 100.0 + 0.5)) / 100.0;
+    }
+
+    struct Variant
+    {
+        std::string_view name;
+        Search search;
+    };
+
+    template <size_t (*Find)(const char*, size_t, const char*, size_t) noexcept> Search substring()
+    {
+        return [](std::string_view h) { return Find(h.data(), h.size(), Needle.data(), Needle.size()); };
+    }
+
+    template <size_t (*FindChar)(const char*, size_t, char) noexcept> Search character()
+    {
+        return [](std::string_view h) { return FindChar(h.data(), h.size(), '#'); };
+    }
+
+    std::string_view levelName(meta::search::SimdLevel level)
+    {
+        switch (level)
+        {
+        case meta::search::SimdLevel::AVX2:
+            return "AVX2";
+        case meta::search::SimdLevel::SSE2:
+            return "SSE2";
+        default:
+            return "scalar";
+        }
+    }
+} // namespace
+
+// Scans 1 KB to 1 MB haystacks for a 6 character substring and for a character that only occur at the end, with each
+// StringSearch kernel forced, through the runtime dispatch, and with std::string_view::find. Prints GB/s.
+int main()
+{
+    meta::search::SimdLevel level = meta::search::detectSimdLevel();
+    std::vector<Variant> substrings = {
+        { "string_view", [](std::string_view h) { return h.find(Needle); } },
+        { "scalar     ", substring<meta::search::scalar::find>() },
+    };
+#if defined(META_ARCH_X64)
+    substrings.push_back({ "sse2       ", substring<meta::search::sse2::find>() });
+    if (level == meta::search::SimdLevel::AVX2)
+        substrings.push_back({ "avx2       ", substring<meta::search::avx2::find>() });
+#endif
+    substrings.push_back({ "dispatch   ", substring<meta::search::find>() });
+
+    // Single characters have no kernels of their own; the dispatching findChar forwards to memchr
+    const Variant characters[] = {
+        { "string_view", [](std::string_view h) { return h.find('#'); } },
+        { "scalar     ", character<meta::search::scalar::findChar>() },
+        { "dispatch   ", character<meta::search::findChar>() },
+    };
+
+    meta::println<"dispatch picks {}">(levelName(level));
+    for (size_t size : { 1024, 16 * 1024, 256 * 1024, 1024 * 1024 })
+    {
+        std::string haystack = makeHaystack(size);
+        meta::println<"{} KB haystack">(size / 1024);
+        for (const Variant& variant : substrings)
+            meta::println<"  substring {} {} GB/s">(variant.name, round(measure(haystack, variant.search)));
+        for (const Variant& variant : characters)
+            meta::println<"  char      {} {} GB/s">(variant.name, round(measure(haystack, variant.search)));
+    }
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <exception>
+#include <meta/base/app/BinaryLog.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Timestamp.hpp>
+
+// Renders a binary log written by meta::BinaryLog as text, one record per line
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        meta::errorln("usage: meta_logdecode <file.blog> [--utc]");
+        return 1;
+    }
+
+    bool utc = argc > 2 && std::string_view(argv[2]) == "--utc";
+
+    try
+    {
+        meta::BinaryLogReader reader{ meta::Path(argv[1]) };
+        meta::TimestampCache timestamps;
+
+        reader.forEach(
+            [&](int64_t timestampNs, std::string_view text)
+            {
+                std::chrono::system_clock::time_point time{ std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(timestampNs)) };
+                char stamp[meta::TimestampCache::MaxLength];
+                size_t length = timestamps.format(stamp, time, meta::TimestampPrecision::Microseconds, utc);
+                meta::println<"[{}] {}">(std::string_view(stamp, length), text);
+            });
+    }
+    catch (const std::exception& e)
+    {
+        meta::errorln("meta_logdecode: ", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,598 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/String.hpp>
+#include <meta/base/filesystem/MappedFile.hpp>
+#include <meta/base/filesystem/Path.hpp>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace meta
+{
+    // On-disk layout shared by BinaryLog (writer) and BinaryLogReader:
+    //   FileHeader | metadata (call-site definitions, append-only) | ring (records, oldest overwritten first)
+    // A record is a RecordHeader followed by the raw argument bytes, padded to 8 bytes. The text is rendered from the
+    // call site's pattern only when the log is decoded.
+    namespace binlog
+    {
+        inline constexpr char Magic[8] = { 'M', 'E', 'T', 'A', 'B', 'L', 'O', 'G' };
+        inline constexpr uint32_t Version = 1;
+        inline constexpr uint32_t PaddingSite = UINT32_MAX; // fills the ring tail before wrapping
+
+        enum class ArgType : uint8_t
+        {
+            Bool = 1,
+            Char,
+            Int8,
+            Int16,
+            Int32,
+            Int64,
+            UInt8,
+            UInt16,
+            UInt32,
+            UInt64,
+            Float,
+            Double,
+            String, // uint32 length + bytes
+        };
+
+        struct FileHeader
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t headerSize;
+            uint64_t metadataOffset;
+            uint64_t metadataCapacity;
+            std::atomic<uint64_t> metadataUsed;
+            uint64_t ringOffset;
+            uint64_t ringCapacity;
+            std::atomic<uint64_t> head; // monotonic byte position one past the newest record
+            std::atomic<uint64_t> tail; // monotonic byte position of the oldest record
+        };
+
+        struct RecordHeader
+        {
+            uint32_t site;
+            uint32_t size; // header + payload + padding
+            int64_t timestamp; // nanoseconds since the Unix epoch
+        };
+
+        // Call-site definition in the metadata area, followed by argCount ArgType bytes and the pattern
+        struct SiteHeader
+        {
+            uint32_t id;
+            uint16_t argCount;
+            uint16_t patternLength;
+        };
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "binary log header requires lock-free 64-bit atomics");
+
+        template <typename T> consteval ArgType argTypeOf()
+        {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, bool>)
+                return ArgType::Bool;
+            else if constexpr (std::is_same_v<U, char>)
+                return ArgType::Char;
+            else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+                return sizeof(U) == 1 ? ArgType::Int8
+                                      : sizeof(U) == 2 ? ArgType::Int16 : sizeof(U) == 4 ? ArgType::Int32 : ArgType::Int64;
+            else if constexpr (std::is_integral_v<U>)
+                return sizeof(U) == 1 ? ArgType::UInt8
+                                      : sizeof(U) == 2 ? ArgType::UInt16
+                                                       : sizeof(U) == 4 ? ArgType::UInt32 : ArgType::UInt64;
+            else if constexpr (std::is_same_v<U, float>)
+                return ArgType::Float;
+            else if constexpr (std::is_floating_point_v<U>)
+                return ArgType::Double;
+            else
+                return ArgType::String;
+        }
+
+        // Numbers, bools, chars and anything viewable as text can be logged
+        template <typename T>
+        concept Encodable = std::is_arithmetic_v<std::remove_cvref_t<T>> || std::is_convertible_v<const T&, std::string_view>;
+
+        template <typename T> META_INLINE size_t encodedSize(const T& value) noexcept
+        {
+            if constexpr (argTypeOf<T>() == ArgType::String)
+                return sizeof(uint32_t) + std::string_view(value).size();
+            else if constexpr (argTypeOf<T>() == ArgType::Double)
+                return sizeof(double);
+            else
+                return sizeof(std::remove_cvref_t<T>);
+        }
+
+        template <typename T> META_INLINE void encode(char*& out, const T& value) noexcept
+        {
+            if constexpr (argTypeOf<T>() == ArgType::String)
+            {
+                std::string_view text(value);
+                auto length = static_cast<uint32_t>(text.size());
+                std::memcpy(out, &length, sizeof(length));
+                std::memcpy(out + sizeof(length), text.data(), length);
+                out += sizeof(length) + length;
+            }
+            else if constexpr (argTypeOf<T>() == ArgType::Double)
+            {
+                auto number = static_cast<double>(value);
+                std::memcpy(out, &number, sizeof(number));
+                out += sizeof(number);
+            }
+            else
+            {
+                std::memcpy(out, &value, sizeof(value));
+                out += sizeof(value);
+            }
+        }
+
+        META_INLINE constexpr size_t align8(size_t size) noexcept
+        {
+            return (size + 7) & ~size_t(7);
+        }
+    } // namespace binlog
+
+    namespace internal
+    {
+        struct BinarySite
+        {
+            std::string_view pattern;
+            const binlog::ArgType* types;
+            uint16_t argCount;
+        };
+
+        // Process-wide list of call sites; ids start at 1 and are never reused
+        class BinarySiteRegistry
+        {
+        public:
+            static BinarySiteRegistry& instance()
+            {
+                static BinarySiteRegistry registry;
+                return registry;
+            }
+
+            uint32_t add(const BinarySite& site)
+            {
+                std::lock_guard lock(m_mutex);
+                m_sites.push_back(site);
+                return static_cast<uint32_t>(m_sites.size());
+            }
+
+            uint32_t size() const
+            {
+                std::lock_guard lock(m_mutex);
+                return static_cast<uint32_t>(m_sites.size());
+            }
+
+            BinarySite get(uint32_t id) const
+            {
+                std::lock_guard lock(m_mutex);
+                return m_sites[id - 1];
+            }
+
+        private:
+            mutable std::mutex m_mutex;
+            std::deque<BinarySite> m_sites;
+        };
+
+        // One registration per pattern and argument type list, done on first use
+        template <FixedString Pattern, typename... Args> struct BinaryCallSite
+        {
+            static constexpr binlog::ArgType types[] = { binlog::argTypeOf<Args>()..., binlog::ArgType{} };
+
+            static uint32_t id()
+            {
+                static const uint32_t value = BinarySiteRegistry::instance().add(
+                    BinarySite{ std::string_view(Pattern.data, Pattern.size()), types, sizeof...(Args) });
+                return value;
+            }
+        };
+    } // namespace internal
+
+    // Binary structured log in a memory-mapped ring file. Each call site registers its pattern and argument types
+    // once; a record then costs a clock read and a copy of the raw argument bytes, with no text formatting.
+    // Decode the file with BinaryLogReader (or the meta_logdecode tool). When the ring is full the oldest records
+    // are overwritten, and records already in the file survive a crash of the process.
+    class BinaryLog
+    {
+    public:
+        static constexpr size_t DefaultRingCapacity = 16 * 1024 * 1024;
+        static constexpr size_t MetadataCapacity = 256 * 1024;
+
+        BinaryLog() = default;
+
+        explicit BinaryLog(const Path& path, size_t ringCapacity = DefaultRingCapacity)
+        {
+            open(path, ringCapacity);
+        }
+
+        ~BinaryLog()
+        {
+            close();
+        }
+
+        BinaryLog(const BinaryLog&) = delete;
+        BinaryLog& operator=(const BinaryLog&) = delete;
+
+        // Creates (or truncates) the log file
+        void open(const Path& path, size_t ringCapacity = DefaultRingCapacity)
+        {
+            close();
+
+            size_t headerSize = binlog::align8(sizeof(binlog::FileHeader));
+            size_t capacity = (std::max<size_t>(ringCapacity, 4096) + 4095) & ~size_t(4095);
+            m_file.open(path, MappedFile::Mode::ReadWrite, headerSize + MetadataCapacity + capacity);
+
+            m_header = new (m_file.data()) binlog::FileHeader{};
+            std::memcpy(m_header->magic, binlog::Magic, sizeof(binlog::Magic));
+            m_header->version = binlog::Version;
+            m_header->headerSize = static_cast<uint32_t>(headerSize);
+            m_header->metadataOffset = headerSize;
+            m_header->metadataCapacity = MetadataCapacity;
+            m_header->ringOffset = headerSize + MetadataCapacity;
+            m_header->ringCapacity = capacity;
+
+            m_metadata = m_file.data() + headerSize;
+            m_ring = m_file.data() + headerSize + MetadataCapacity;
+            m_ringCapacity = capacity;
+            m_sitesPublished = 0;
+        }
+
+        void close()
+        {
+            if (!m_header)
+                return;
+            m_file.sync();
+            m_file.close();
+            m_header = nullptr;
+        }
+
+        META_NODISCARD bool isOpen() const noexcept
+        {
+            return m_header != nullptr;
+        }
+
+        // Asks the OS to write dirty pages to disk; records are already visible to readers without it
+        void sync() noexcept
+        {
+            m_file.sync();
+        }
+
+        // e.g. log.write<"order {} filled at {}">(orderId, price)
+        template <FixedString Pattern, typename... Args> void write(const Args&... args)
+        {
+            static_assert(internal::argCount<Pattern>() == sizeof...(Args),
+                          "number of arguments does not match the number of {} in the pattern");
+            static_assert((binlog::Encodable<Args> && ...), "binary log arguments must be numbers or text");
+
+            if (!m_header)
+                return;
+
+            const uint32_t site = internal::BinaryCallSite<Pattern, std::remove_cvref_t<Args>...>::id();
+            size_t payload = (size_t(0) + ... + binlog::encodedSize(args));
+            size_t size = binlog::align8(sizeof(binlog::RecordHeader) + payload);
+            int64_t timestamp =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+
+            while (m_lock.test_and_set(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            if (site > m_sitesPublished)
+                publishSites();
+
+            uint64_t head;
+            if (char* out = reserve(size, head))
+            {
+                binlog::RecordHeader header{ site, static_cast<uint32_t>(size), timestamp };
+                std::memcpy(out, &header, sizeof(header));
+                out += sizeof(header);
+                (binlog::encode(out, args), ...);
+                m_header->head.store(head + size, std::memory_order_release);
+            }
+
+            m_lock.clear(std::memory_order_release);
+        }
+
+    private:
+        MappedFile m_file;
+        binlog::FileHeader* m_header = nullptr;
+        char* m_metadata = nullptr;
+        char* m_ring = nullptr;
+        size_t m_ringCapacity = 0;
+        uint32_t m_sitesPublished = 0;
+        std::atomic_flag m_lock = ATOMIC_FLAG_INIT;
+
+        // Appends definitions of every site registered since the last call; sites that don't fit are skipped
+        void publishSites()
+        {
+            auto& registry = internal::BinarySiteRegistry::instance();
+            uint32_t count = registry.size();
+            uint64_t used = m_header->metadataUsed.load(std::memory_order_relaxed);
+
+            for (uint32_t id = m_sitesPublished + 1; id <= count; ++id)
+            {
+                internal::BinarySite site = registry.get(id);
+                binlog::SiteHeader header{ id, site.argCount, static_cast<uint16_t>(site.pattern.size()) };
+                size_t entrySize = sizeof(header) + header.argCount + header.patternLength;
+                if (used + entrySize > MetadataCapacity)
+                    break;
+
+                char* out = m_metadata + used;
+                std::memcpy(out, &header, sizeof(header));
+                std::memcpy(out + sizeof(header), site.types, header.argCount);
+                std::memcpy(out + sizeof(header) + header.argCount, site.pattern.data(), header.patternLength);
+                used += entrySize;
+            }
+
+            m_header->metadataUsed.store(used, std::memory_order_release);
+            m_sitesPublished = count;
+        }
+
+        // Space for a record of the given size at ring position head, evicting the oldest records as needed
+        char* reserve(size_t size, uint64_t& head)
+        {
+            if (size > m_ringCapacity)
+                return nullptr;
+
+            head = m_header->head.load(std::memory_order_relaxed);
+            size_t offset = head % m_ringCapacity;
+            size_t remaining = m_ringCapacity - offset;
+
+            if (remaining < size)
+            {
+                // Not enough room before the end of the ring: pad it out and start over at offset 0
+                evictUntil(head + remaining + size);
+                if (remaining >= sizeof(binlog::RecordHeader))
+                {
+                    binlog::RecordHeader padding{ binlog::PaddingSite, static_cast<uint32_t>(remaining), 0 };
+                    std::memcpy(m_ring + offset, &padding, sizeof(padding));
+                }
+                head += remaining;
+                m_header->head.store(head, std::memory_order_release);
+                return m_ring;
+            }
+
+            evictUntil(head + size);
+            return m_ring + offset;
+        }
+
+        void evictUntil(uint64_t end)
+        {
+            uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+            while (end - tail > m_ringCapacity)
+            {
+                size_t offset = tail % m_ringCapacity;
+                size_t remaining = m_ringCapacity - offset;
+                if (remaining < sizeof(binlog::RecordHeader))
+                {
+                    tail += remaining;
+                    continue;
+                }
+
+                binlog::RecordHeader header;
+                std::memcpy(&header, m_ring + offset, sizeof(header));
+                tail += header.site == binlog::PaddingSite ? remaining : header.size;
+            }
+            m_header->tail.store(tail, std::memory_order_release);
+        }
+    };
+
+    // Reads a binary log file and renders its records to text, oldest first
+    class BinaryLogReader
+    {
+    public:
+        explicit BinaryLogReader(const Path& path) : m_file(path, MappedFile::Mode::Read)
+        {
+            if (m_file.size() < sizeof(binlog::FileHeader))
+                throw std::runtime_error("Not a binary log: " + path.toString());
+
+            const auto* header = reinterpret_cast<const binlog::FileHeader*>(m_file.data());
+            if (std::memcmp(header->magic, binlog::Magic, sizeof(binlog::Magic)) != 0 ||
+                header->version != binlog::Version)
+                throw std::runtime_error("Not a binary log: " + path.toString());
+
+            m_header.metadataOffset = header->metadataOffset;
+            m_header.metadataCapacity = header->metadataCapacity;
+            m_header.ringOffset = header->ringOffset;
+            m_header.ringCapacity = header->ringCapacity;
+            m_head = header->head.load(std::memory_order_acquire);
+            m_tail = header->tail.load(std::memory_order_acquire);
+            if (m_header.ringCapacity == 0 || m_header.ringOffset + m_header.ringCapacity > m_file.size() ||
+                m_header.metadataOffset + m_header.metadataCapacity > m_file.size())
+                throw std::runtime_error("Truncated binary log: " + path.toString());
+
+            loadSites(header->metadataUsed.load(std::memory_order_acquire));
+        }
+
+        META_NODISCARD size_t siteCount() const noexcept
+        {
+            return m_sites.size();
+        }
+
+        // Calls func(timestampNs, text) for every record
+        template <typename Func> void forEach(Func&& func) const
+        {
+            const char* ring = m_file.data() + m_header.ringOffset;
+            size_t capacity = m_header.ringCapacity;
+            meta::String<> text;
+
+            for (uint64_t pos = m_tail; pos < m_head;)
+            {
+                size_t offset = pos % capacity;
+                size_t remaining = capacity - offset;
+                if (remaining < sizeof(binlog::RecordHeader))
+                {
+                    pos += remaining;
+                    continue;
+                }
+
+                binlog::RecordHeader header;
+                std::memcpy(&header, ring + offset, sizeof(header));
+                if (header.site == binlog::PaddingSite)
+                {
+                    pos += remaining;
+                    continue;
+                }
+                if (header.size < sizeof(header) || header.size > remaining)
+                    break; // corrupt
+
+                text.clear();
+                render(text, header.site, ring + offset + sizeof(header), header.size - sizeof(header));
+                func(header.timestamp, std::string_view(text));
+                pos += header.size;
+            }
+        }
+
+    private:
+        struct Site
+        {
+            std::string_view pattern;
+            std::vector<binlog::ArgType> types;
+        };
+
+        struct Layout
+        {
+            uint64_t metadataOffset;
+            uint64_t metadataCapacity;
+            uint64_t ringOffset;
+            uint64_t ringCapacity;
+        };
+
+        MappedFile m_file;
+        Layout m_header{};
+        uint64_t m_head = 0;
+        uint64_t m_tail = 0;
+        std::vector<Site> m_sites; // index = id - 1
+
+        void loadSites(uint64_t used)
+        {
+            const char* data = m_file.data() + m_header.metadataOffset;
+            used = std::min<uint64_t>(used, m_header.metadataCapacity);
+
+            for (uint64_t pos = 0; pos + sizeof(binlog::SiteHeader) <= used;)
+            {
+                binlog::SiteHeader header;
+                std::memcpy(&header, data + pos, sizeof(header));
+                pos += sizeof(header);
+                if (pos + header.argCount + header.patternLength > used)
+                    break;
+
+                if (m_sites.size() < header.id)
+                    m_sites.resize(header.id);
+
+                Site& site = m_sites[header.id - 1];
+                const auto* types = reinterpret_cast<const binlog::ArgType*>(data + pos);
+                site.types.assign(types, types + header.argCount);
+                site.pattern = std::string_view(data + pos + header.argCount, header.patternLength);
+                pos += header.argCount + header.patternLength;
+            }
+        }
+
+        template <typename T> static bool readValue(const char*& in, const char* end, T& value)
+        {
+            if (static_cast<size_t>(end - in) < sizeof(T))
+                return false;
+            std::memcpy(&value, in, sizeof(T));
+            in += sizeof(T);
+            return true;
+        }
+
+        template <typename T> static bool appendValue(meta::String<>& out, const char*& in, const char* end)
+        {
+            T value;
+            if (!readValue(in, end, value))
+                return false;
+            meta::formatTo(out, value);
+            return true;
+        }
+
+        static bool appendArg(meta::String<>& out, binlog::ArgType type, const char*& in, const char* end)
+        {
+            using binlog::ArgType;
+            switch (type)
+            {
+            case ArgType::Bool:
+                return appendValue<bool>(out, in, end);
+            case ArgType::Char:
+                return appendValue<char>(out, in, end);
+            case ArgType::Int8:
+                return appendValue<int8_t>(out, in, end);
+            case ArgType::Int16:
+                return appendValue<int16_t>(out, in, end);
+            case ArgType::Int32:
+                return appendValue<int32_t>(out, in, end);
+            case ArgType::Int64:
+                return appendValue<int64_t>(out, in, end);
+            case ArgType::UInt8:
+                return appendValue<uint8_t>(out, in, end);
+            case ArgType::UInt16:
+                return appendValue<uint16_t>(out, in, end);
+            case ArgType::UInt32:
+                return appendValue<uint32_t>(out, in, end);
+            case ArgType::UInt64:
+                return appendValue<uint64_t>(out, in, end);
+            case ArgType::Float:
+                return appendValue<float>(out, in, end);
+            case ArgType::Double:
+                return appendValue<double>(out, in, end);
+            case ArgType::String: {
+                uint32_t length;
+                if (!readValue(in, end, length) || static_cast<size_t>(end - in) < length)
+                    return false;
+                out += std::string_view(in, length);
+                in += length;
+                return true;
+            }
+            }
+            return false;
+        }
+
+        void render(meta::String<>& out, uint32_t siteId, const char* payload, size_t size) const
+        {
+            if (siteId == 0 || siteId > m_sites.size() || m_sites[siteId - 1].pattern.empty())
+            {
+                meta::formatTo<"<unknown call site {}>">(out, siteId);
+                return;
+            }
+
+            const Site& site = m_sites[siteId - 1];
+            const char* end = payload + size;
+            std::string_view pattern = site.pattern;
+            size_t arg = 0;
+
+            for (size_t i = 0; i < pattern.size(); ++i)
+            {
+                char c = pattern[i];
+                if ((c == '{' || c == '}') && i + 1 < pattern.size() && pattern[i + 1] == c)
+                {
+                    out += c;
+                    ++i;
+                }
+                else if (c == '{' && i + 1 < pattern.size() && pattern[i + 1] == '}')
+                {
+                    if (arg >= site.types.size() || !appendArg(out, site.types[arg++], payload, end))
+                        out += "<?>";
+                    ++i;
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+        }
+    };
+} // namespace meta
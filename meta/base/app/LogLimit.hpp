@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <meta/base/app/LogSink.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/ThreadInfo.hpp>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace meta
+{
+    // How often a rate-limited log statement lets a record through
+    struct LogLimit
+    {
+        enum class Kind
+        {
+            EveryN,      // the 1st, (n+1)th, (2n+1)th, ... call
+            Probability, // each call independently with the given probability
+            Rate,        // token bucket: `burst` records at once, refilled at `perSecond`
+        };
+
+        Kind kind = Kind::EveryN;
+        uint64_t n = 1;
+        double probability = 1.0;
+        double perSecond = 0.0;
+        uint32_t burst = 1;
+
+        static constexpr LogLimit everyN(uint64_t n) noexcept
+        {
+            return { Kind::EveryN, n > 0 ? n : 1, 1.0, 0.0, 1 };
+        }
+
+        static constexpr LogLimit sampled(double probability) noexcept
+        {
+            return { Kind::Probability, 1, probability, 0.0, 1 };
+        }
+
+        static constexpr LogLimit perSecondRate(double perSecond, uint32_t burst = 1) noexcept
+        {
+            return { Kind::Rate, 1, 1.0, perSecond, burst > 0 ? burst : 1 };
+        }
+    };
+
+    class LogSite;
+
+    namespace internal
+    {
+        // Every LogSite ever constructed; sites live in static storage and are never removed
+        struct LogSiteRegistry
+        {
+            std::atomic<LogSite*> head{ nullptr };
+            std::mutex reportMutex; // serializes LogSite::takeSuppressed
+
+            static LogSiteRegistry& instance()
+            {
+                static LogSiteRegistry registry;
+                return registry;
+            }
+        };
+
+        // xorshift64*, one stream per thread
+        META_INLINE uint64_t logSampleRandom() noexcept
+        {
+            thread_local uint64_t state = 0x9E3779B97F4A7C15ull * (currentThreadId() + 1);
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1Dull;
+        }
+    } // namespace internal
+
+    // State of one rate-limited log statement, declared as a function-local static by META_LOG_LIMITED. A site
+    // belongs to the logger and level of its statement; only that logger reports what it suppressed.
+    // admit() is one atomic read-modify-write (rate limits also read the clock). The class is trivially destructible,
+    // so sites stay valid while other statics are destroyed.
+    class LogSite
+    {
+    public:
+        enum class Decision
+        {
+            Admit,
+            Suppress,
+            SuppressAndCheck, // suppressed; every ReportCheckInterval-th suppression also polls the report deadline
+        };
+
+        static constexpr uint64_t ReportCheckInterval = 256;
+
+        LogSite(std::string_view file, int line, LogLimit limit, const void* owner, LogLevel level) noexcept
+            : m_file(file), m_line(line), m_kind(limit.kind), m_n(limit.n), m_owner(owner), m_level(level)
+        {
+            if (m_kind == LogLimit::Kind::Probability)
+            {
+                double scaled = std::clamp(limit.probability, 0.0, 1.0) * 18446744073709551616.0; // p * 2^64
+                m_threshold = scaled >= 18446744073709551615.0 ? UINT64_MAX : static_cast<uint64_t>(scaled);
+            }
+            else if (m_kind == LogLimit::Kind::Rate)
+            {
+                // A rate of zero lets the first record through and then nothing for a very long time
+                if (limit.perSecond > 0.0)
+                {
+                    m_intervalNs = std::max<int64_t>(static_cast<int64_t>(1e9 / limit.perSecond), 1);
+                    m_burstNs = m_intervalNs * static_cast<int64_t>(limit.burst - 1);
+                }
+                else
+                {
+                    m_intervalNs = INT64_MAX / 4;
+                }
+            }
+
+            auto& registry = internal::LogSiteRegistry::instance();
+            m_next = registry.head.load(std::memory_order_relaxed);
+            while (!registry.head.compare_exchange_weak(m_next, this, std::memory_order_release,
+                                                        std::memory_order_relaxed))
+            {
+            }
+        }
+
+        LogSite(const LogSite&) = delete;
+        LogSite& operator=(const LogSite&) = delete;
+
+        META_NODISCARD Decision admit() noexcept
+        {
+            switch (m_kind)
+            {
+            case LogLimit::Kind::EveryN: {
+                uint64_t call = m_state.fetch_add(1, std::memory_order_relaxed);
+                if (call % m_n == 0)
+                    return Decision::Admit;
+                return call % ReportCheckInterval == 0 ? Decision::SuppressAndCheck : Decision::Suppress;
+            }
+            case LogLimit::Kind::Probability:
+                if (m_threshold == UINT64_MAX || internal::logSampleRandom() < m_threshold)
+                    return Decision::Admit;
+                return suppress();
+            default:
+                return admitRate() ? Decision::Admit : suppress();
+            }
+        }
+
+        // Records suppressed since the previous call
+        META_NODISCARD uint64_t takeSuppressed() noexcept
+        {
+            if (m_kind != LogLimit::Kind::EveryN)
+                return m_suppressed.exchange(0, std::memory_order_relaxed);
+
+            // Derived from the call count, so admit() doesn't need a second counter
+            uint64_t calls = m_state.load(std::memory_order_relaxed);
+            uint64_t suppressed = calls - (calls + m_n - 1) / m_n;
+            uint64_t delta = suppressed - m_reported;
+            m_reported = suppressed;
+            return delta;
+        }
+
+        META_NODISCARD std::string_view file() const noexcept
+        {
+            return m_file;
+        }
+
+        META_NODISCARD int line() const noexcept
+        {
+            return m_line;
+        }
+
+        // The logger of the statement; only compared, never dereferenced
+        META_NODISCARD const void* owner() const noexcept
+        {
+            return m_owner;
+        }
+
+        META_NODISCARD LogLevel level() const noexcept
+        {
+            return m_level;
+        }
+
+        META_NODISCARD LogSite* next() const noexcept
+        {
+            return m_next;
+        }
+
+    private:
+        std::string_view m_file;
+        int m_line;
+        LogLimit::Kind m_kind;
+        uint64_t m_n;
+        uint64_t m_threshold = 0; // Probability: admit when a 64-bit random value is below this
+        int64_t m_intervalNs = 0; // Rate: time for one token
+        int64_t m_burstNs = 0;    // Rate: how far ahead of now the bucket may be drawn
+        std::atomic<uint64_t> m_state{ 0 };      // EveryN: calls; Rate: theoretical arrival time of the next record
+        std::atomic<uint64_t> m_suppressed{ 0 }; // Probability and Rate
+        uint64_t m_reported = 0;                 // EveryN: suppressed count already reported
+        const void* m_owner;
+        LogLevel m_level;
+        LogSite* m_next = nullptr;
+
+        Decision suppress() noexcept
+        {
+            uint64_t before = m_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return (before + 1) % ReportCheckInterval == 0 ? Decision::SuppressAndCheck : Decision::Suppress;
+        }
+
+        // Generic cell rate algorithm: the whole bucket is one timestamp updated with a single CAS
+        bool admitRate() noexcept
+        {
+            auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 std::chrono::steady_clock::now().time_since_epoch())
+                                                 .count());
+            uint64_t arrival = m_state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                uint64_t base = std::max(arrival, now);
+                if (base - now > static_cast<uint64_t>(m_burstNs))
+                    return false;
+                if (m_state.compare_exchange_weak(arrival, base + static_cast<uint64_t>(m_intervalNs),
+                                                  std::memory_order_relaxed))
+                    return true;
+            }
+        }
+    };
+
+    // Calls func(site, count) for every site of owner that suppressed records since the previous call, taking the
+    // count. Sites for which accept(site) is false keep their count for a later call. func runs without the registry
+    // lock held, so it may log.
+    template <typename Accept, typename Func>
+    void forEachSuppressedLogSite(const void* owner, Accept&& accept, Func&& func)
+    {
+        std::vector<std::pair<const LogSite*, uint64_t>> reports;
+        {
+            auto& registry = internal::LogSiteRegistry::instance();
+            std::lock_guard lock(registry.reportMutex);
+            for (LogSite* site = registry.head.load(std::memory_order_acquire); site; site = site->next())
+            {
+                if (site->owner() != owner || !accept(*site))
+                    continue;
+                uint64_t count = site->takeSuppressed();
+                if (count > 0)
+                    reports.emplace_back(site, count);
+            }
+        }
+
+        for (const auto& [site, count] : reports)
+            func(*site, count);
+    }
+} // namespace meta
@@ -0,0 +1,415 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <meta/base/core/Atom.hpp>
+#include <meta/base/core/BoundedQueue.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/String.hpp>
+#include <meta/base/core/ThreadInfo.hpp>
+#include <meta/base/filesystem/Path.hpp>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Numeric levels for META_LOG_MIN_LEVEL; they match meta::LogLevel
+#define META_LOG_LEVEL_DEBUG 0
+#define META_LOG_LEVEL_INFO 1
+#define META_LOG_LEVEL_WARNING 2
+#define META_LOG_LEVEL_ERROR 3
+#define META_LOG_LEVEL_OFF 4
+
+// Calls below this level are removed at compile time, e.g. -DMETA_LOG_MIN_LEVEL=META_LOG_LEVEL_INFO
+#ifndef META_LOG_MIN_LEVEL
+#define META_LOG_MIN_LEVEL META_LOG_LEVEL_DEBUG
+#endif
+
+namespace meta
+{
+    enum class LogLevel
+    {
+        Debug = META_LOG_LEVEL_DEBUG,
+        Info = META_LOG_LEVEL_INFO,
+        Warning = META_LOG_LEVEL_WARNING,
+        Error = META_LOG_LEVEL_ERROR,
+        Off = META_LOG_LEVEL_OFF
+    };
+
+    inline constexpr LogLevel MinCompiledLevel = static_cast<LogLevel>(META_LOG_MIN_LEVEL);
+
+    // What an async logger or sink does when its queue is full
+    enum class LogOverflow
+    {
+        Block,      // wait for the writer thread to make room
+        DropNewest, // discard the message being logged
+        DropOldest, // discard the oldest queued message
+    };
+
+    // One formatted record; the same message is handed to every sink
+    struct LogMessage
+    {
+        LogLevel level = LogLevel::Info;
+        std::chrono::system_clock::time_point time;
+        meta::String<> text;   // full line, e.g. "[timestamp] [LEVEL] message\n"
+        uint64_t sequence = 0; // per-logger order in which records were created, from 1; 0 if not from a Logger
+        uint32_t threadId = 0; // currentThreadId() of the thread that logged it
+        Atom threadName = {};  // currentThreadName() of that thread
+    };
+
+    // Destination for log records. Sinks filter by their own level and must accept writes from several threads.
+    // Wrap a sink that may block (disk, network) in an AsyncSink so it cannot stall the caller or other sinks.
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+
+        void setLevel(LogLevel level) noexcept
+        {
+            m_level.store(level, std::memory_order_relaxed);
+        }
+
+        META_NODISCARD LogLevel level() const noexcept
+        {
+            return m_level.load(std::memory_order_relaxed);
+        }
+
+        META_NODISCARD bool accepts(LogLevel level) const noexcept
+        {
+            return level >= this->level() && level != LogLevel::Off;
+        }
+
+        virtual void write(const LogMessage& message) = 0;
+
+        // Pushes out anything the sink has batched
+        virtual void flush()
+        {
+        }
+
+    private:
+        std::atomic<LogLevel> m_level{ LogLevel::Debug };
+    };
+
+    namespace internal
+    {
+        // Bounded queue of messages drained in batches by a dedicated thread. Shared by the async Logger mode
+        // and AsyncSink. Everything accepted is handled before stop() returns.
+        class LogWorker
+        {
+        public:
+            static constexpr size_t BatchSize = 256;
+            static constexpr auto IdleWait = std::chrono::milliseconds(10);
+
+            using Handler = std::function<void(const LogMessage&)>;
+            using BatchDone = std::function<void()>;
+
+            LogWorker(size_t capacity, LogOverflow overflow, Handler handler, BatchDone batchDone = {})
+                : m_queue(capacity), m_overflow(overflow), m_handler(std::move(handler)),
+                  m_batchDone(std::move(batchDone)), m_thread([this] { run(); })
+            {
+            }
+
+            ~LogWorker()
+            {
+                stop();
+            }
+
+            LogWorker(const LogWorker&) = delete;
+            LogWorker& operator=(const LogWorker&) = delete;
+
+            void push(LogMessage&& message)
+            {
+                for (;;)
+                {
+                    size_t processed = m_processed.load();
+                    if (m_queue.tryPush(std::move(message)))
+                        break;
+
+                    switch (m_overflow)
+                    {
+                    case LogOverflow::DropNewest:
+                        m_dropped.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    case LogOverflow::DropOldest: {
+                        LogMessage evicted;
+                        if (m_queue.tryPop(evicted))
+                        {
+                            m_dropped.fetch_add(1, std::memory_order_relaxed);
+                            m_processed.fetch_add(1, std::memory_order_release);
+                        }
+                        break;
+                    }
+                    default: {
+                        // Sleeps until the worker has handled something since the failed push, as waitIdle() does
+                        std::unique_lock lock(m_mutex);
+                        m_waiters.fetch_add(1);
+                        m_wake.notify_one();
+                        m_batchHandled.wait_for(lock, IdleWait, [&] { return m_processed.load() != processed; });
+                        m_waiters.fetch_sub(1);
+                        break;
+                    }
+                    }
+                }
+
+                m_queued.fetch_add(1, std::memory_order_release);
+                if (m_idle.load(std::memory_order_relaxed))
+                    m_wake.notify_one();
+            }
+
+            // Blocks until every message pushed so far has been handled, sleeping until the worker reports a batch
+            void waitIdle()
+            {
+                size_t target = m_queued.load(std::memory_order_acquire);
+                std::unique_lock lock(m_mutex);
+                m_waiters.fetch_add(1);
+                m_wake.notify_one();
+                // The timeout covers messages completed by DropOldest evictions, which don't signal
+                while (m_processed.load(std::memory_order_acquire) < target)
+                    m_batchHandled.wait_for(lock, IdleWait);
+                m_waiters.fetch_sub(1);
+            }
+
+            void stop()
+            {
+                if (!m_thread.joinable())
+                    return;
+
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_wake.notify_one();
+                m_thread.join();
+            }
+
+            META_NODISCARD size_t dropped() const noexcept
+            {
+                return m_dropped.load(std::memory_order_relaxed);
+            }
+
+        private:
+            BoundedQueue<LogMessage> m_queue;
+            LogOverflow m_overflow;
+            Handler m_handler;
+            BatchDone m_batchDone;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_batchHandled; // waitIdle() callers and producers blocked on a full queue
+            std::atomic<uint32_t> m_waiters{ 0 };
+            bool m_stopping = false;
+            std::atomic<bool> m_idle{ false };
+            std::atomic<size_t> m_queued{ 0 };    // messages accepted into the queue
+            std::atomic<size_t> m_processed{ 0 }; // messages handled or evicted by DropOldest
+            std::atomic<size_t> m_dropped{ 0 };
+            size_t m_droppedReported = 0; // worker thread only
+            std::thread m_thread;         // last, so it starts after everything above is constructed
+
+            void run()
+            {
+                LogMessage message;
+
+                for (;;)
+                {
+                    size_t count = 0;
+                    while (count < BatchSize && m_queue.tryPop(message))
+                    {
+                        m_handler(message);
+                        ++count;
+                    }
+
+                    size_t dropped = m_dropped.load(std::memory_order_relaxed);
+                    if (dropped != m_droppedReported)
+                    {
+                        LogMessage notice{ LogLevel::Warning, std::chrono::system_clock::now(), {} };
+                        meta::formatTo<"[WARNING] Logger dropped {} messages (queue full)\n">(
+                            notice.text, dropped - m_droppedReported);
+                        m_handler(notice);
+                        m_droppedReported = dropped;
+                    }
+
+                    if (count > 0)
+                    {
+                        if (m_batchDone)
+                            m_batchDone();
+                        // Sequentially consistent with m_waiters, so a waiter either sees the update or gets notified
+                        m_processed.fetch_add(count);
+                        if (m_waiters.load() > 0)
+                        {
+                            // Taking the lock orders the update before a waiter's check of m_processed
+                            std::lock_guard lock(m_mutex);
+                            m_batchHandled.notify_all();
+                        }
+                        continue;
+                    }
+
+                    // Queue was empty: stop if asked, otherwise sleep until a producer wakes us or the wait times out
+                    std::unique_lock lock(m_mutex);
+                    if (m_stopping)
+                        break;
+                    m_idle.store(true, std::memory_order_relaxed);
+                    m_wake.wait_for(lock, IdleWait);
+                    m_idle.store(false, std::memory_order_relaxed);
+                }
+            }
+        };
+    } // namespace internal
+
+    // --- Sinks ---
+
+    // Debug/Info to stdout, Warning/Error to stderr, through the buffered console backend
+    class ConsoleSink : public LogSink
+    {
+    public:
+        void write(const LogMessage& message) override
+        {
+            auto stream = message.level >= LogLevel::Warning ? ConsoleStream::Error : ConsoleStream::Out;
+            internal::consoleWriteRaw(stream, message.text.view());
+        }
+
+        void flush() override
+        {
+            internal::ConsoleBackend::instance().flush();
+        }
+    };
+
+    // Appends to one file; the stream's buffer batches writes until flush()
+    class FileSink : public LogSink
+    {
+    public:
+        explicit FileSink(const Path& path) : m_stream(path.c_str(), std::ios::app | std::ios::binary)
+        {
+        }
+
+        META_NODISCARD bool isOpen() const
+        {
+            return m_stream.is_open();
+        }
+
+        void write(const LogMessage& message) override
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_stream.is_open())
+                m_stream.write(message.text.data(), static_cast<std::streamsize>(message.text.size()));
+        }
+
+        void flush() override
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_stream.is_open())
+                m_stream.flush();
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::ofstream m_stream;
+    };
+
+    // Keeps the most recent messages in memory, e.g. to attach to a crash report or show in a debug overlay
+    class MemorySink : public LogSink
+    {
+    public:
+        explicit MemorySink(size_t capacity = 1024) : m_messages(capacity > 0 ? capacity : 1)
+        {
+        }
+
+        void write(const LogMessage& message) override
+        {
+            std::lock_guard lock(m_mutex);
+            m_messages[m_next % m_messages.size()] = message;
+            ++m_next;
+        }
+
+        // Oldest first
+        META_NODISCARD std::vector<LogMessage> snapshot() const
+        {
+            std::lock_guard lock(m_mutex);
+            size_t count = std::min(m_next, m_messages.size());
+            std::vector<LogMessage> result;
+            result.reserve(count);
+            for (size_t i = m_next - count; i < m_next; ++i)
+                result.push_back(m_messages[i % m_messages.size()]);
+            return result;
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<LogMessage> m_messages;
+        size_t m_next = 0;
+    };
+
+    // Forwards every message to a user function; calls are serialized
+    class CallbackSink : public LogSink
+    {
+    public:
+        using Callback = std::function<void(const LogMessage&)>;
+
+        explicit CallbackSink(Callback callback) : m_callback(std::move(callback))
+        {
+        }
+
+        void write(const LogMessage& message) override
+        {
+            std::lock_guard lock(m_mutex);
+            m_callback(message);
+        }
+
+    private:
+        std::mutex m_mutex;
+        Callback m_callback;
+    };
+
+    // Runs another sink on its own thread: write() only queues a copy of the message, and the wrapped sink is
+    // flushed after every batch, so a slow destination delays nothing but itself.
+    class AsyncSink : public LogSink
+    {
+    public:
+        static constexpr size_t DefaultQueueCapacity = 8192;
+
+        explicit AsyncSink(std::shared_ptr<LogSink> sink, size_t capacity = DefaultQueueCapacity,
+                           LogOverflow overflow = LogOverflow::Block)
+            : m_sink(std::move(sink)),
+              m_worker(
+                  capacity, overflow,
+                  [this](const LogMessage& message)
+                  {
+                      if (m_sink->accepts(message.level))
+                          m_sink->write(message);
+                  },
+                  [this] { m_sink->flush(); })
+        {
+        }
+
+        ~AsyncSink() override
+        {
+            m_worker.stop();
+            m_sink->flush();
+        }
+
+        void write(const LogMessage& message) override
+        {
+            m_worker.push(LogMessage(message));
+        }
+
+        void flush() override
+        {
+            m_worker.waitIdle();
+            m_sink->flush();
+        }
+
+        META_NODISCARD size_t droppedCount() const noexcept
+        {
+            return m_worker.dropped();
+        }
+
+    private:
+        std::shared_ptr<LogSink> m_sink;
+        internal::LogWorker m_worker;
+    };
+} // namespace meta
@@ -1,100 +1,455 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <fstream>
-#include <iomanip>
+#include <concepts>
+#include <cstdint>
 #include <memory>
-#include <meta/base/core/Console.hpp>
+#include <meta/base/app/LogLimit.hpp>
+#include <meta/base/app/LogSink.hpp>
+#include <meta/base/app/RotatingFileSink.hpp>
 #include <meta/base/core/String.hpp>
-#include <sstream>
+#include <meta/base/core/ThreadInfo.hpp>
+#include <meta/base/core/Timestamp.hpp>
+#include <meta/base/filesystem/Path.hpp>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace meta
 {
-    enum class LogLevel
-    {
-        Debug = 0,
-        Info,
-        Warning,
-        Error,
-        Off
-    };
-
+    // Formats each record once and hands it to every sink whose level accepts it.
+    // Starts with a ConsoleSink; add file, rotating, memory or callback sinks with addSink().
     class Logger
     {
     public:
-        Logger() = default;
+        static constexpr size_t DefaultQueueCapacity = 8192;
+
+        Logger()
+        {
+            m_sinks.push_back(std::make_shared<ConsoleSink>());
+        }
+
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        ~Logger()
+        {
+            reportSuppressed();
+            disableAsync();
+            flushSinks();
+        }
 
         void setLevel(LogLevel level)
         {
-            m_level = level;
+            m_level.store(level, std::memory_order_relaxed);
         }
 
         void includeTimestamps(bool enabled)
         {
-            m_includeTimestamps = enabled;
+            m_includeTimestamps.store(enabled, std::memory_order_relaxed);
+        }
+
+        void setTimestampPrecision(TimestampPrecision precision)
+        {
+            m_timestampPrecision.store(precision, std::memory_order_relaxed);
+        }
+
+        // Timestamps in UTC instead of local time
+        void useUtcTimestamps(bool enabled)
+        {
+            m_utcTimestamps.store(enabled, std::memory_order_relaxed);
+        }
+
+        // Prefixes each line with the thread's name, or "thread <id>" if it has none (see setCurrentThreadName)
+        void includeThreadNames(bool enabled)
+        {
+            m_includeThreadNames.store(enabled, std::memory_order_relaxed);
+        }
+
+        // Prefixes each line with "#<sequence>", so the creation order across threads can be restored later
+        void includeSequenceNumbers(bool enabled)
+        {
+            m_includeSequenceNumbers.store(enabled, std::memory_order_relaxed);
+        }
+
+        // How often statements limited with META_LOG_*_LIMITED summarize what they suppressed
+        void setSuppressionReportInterval(std::chrono::milliseconds interval)
+        {
+            m_suppressionInterval.store(interval.count(), std::memory_order_relaxed);
+            m_nextSuppressionReport.store(suppressionDeadline(), std::memory_order_relaxed);
+        }
+
+        // Logs one line per limited statement of this logger that suppressed records since the last report, at the
+        // statement's own level. Statements whose level is currently disabled keep their counts until it is enabled.
+        void reportSuppressed()
+        {
+            m_nextSuppressionReport.store(suppressionDeadline(), std::memory_order_relaxed);
+            forEachSuppressedLogSite(
+                this, [this](const LogSite& site) { return isEnabled(site.level()); },
+                [this](const LogSite& site, uint64_t count)
+                { log(site.level(), "Suppressed ", count, " messages from ", site.file(), ':', site.line()); });
+        }
+
+        // Called by META_LOG_LIMITED after a record gets through and every LogSite::ReportCheckInterval suppressed
+        // records; reports once the interval has passed. A statement that is no longer reached is summarized by the
+        // next report of another statement, flush() or the destructor.
+        void reportSuppressedIfDue()
+        {
+            int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+            int64_t due = m_nextSuppressionReport.load(std::memory_order_relaxed);
+            if (now >= due && m_nextSuppressionReport.compare_exchange_strong(due, suppressionDeadline()))
+                reportSuppressed();
+        }
+
+        // --- Sinks ---
+
+        void addSink(std::shared_ptr<LogSink> sink)
+        {
+            std::unique_lock lock(m_sinksMutex);
+            m_sinks.push_back(std::move(sink));
+        }
+
+        void removeSink(const std::shared_ptr<LogSink>& sink)
+        {
+            std::unique_lock lock(m_sinksMutex);
+            std::erase(m_sinks, sink);
+        }
+
+        // Removes every sink, including the default console sink
+        void clearSinks()
+        {
+            std::unique_lock lock(m_sinksMutex);
+            m_sinks.clear();
+            m_fileSink.reset();
+        }
+
+        // Also writes to the given file; replaces the file set by a previous call
+        void setFile(const Path& filepath)
+        {
+            auto sink = std::make_shared<FileSink>(filepath);
+
+            std::unique_lock lock(m_sinksMutex);
+            if (m_fileSink)
+                std::erase(m_sinks, m_fileSink);
+            m_fileSink = sink;
+            m_sinks.push_back(std::move(sink));
+        }
+
+        // Callers only format the line and queue it; a background thread hands queued lines to the sinks in
+        // batches. Everything queued is written before disableAsync() or the destructor returns.
+        // A sink that can block should additionally be wrapped in an AsyncSink so it doesn't hold up the others.
+        // Switching modes is safe while other threads log; records logged during the switch take either path.
+        void enableAsync(size_t capacity = DefaultQueueCapacity, LogOverflow overflow = LogOverflow::Block)
+        {
+            std::lock_guard lock(m_modeMutex);
+            stopWorker();
+            auto worker = std::make_unique<internal::LogWorker>(capacity, overflow,
+                                                                [this](const LogMessage& message) { dispatch(message); });
+            m_worker.store(worker.release());
+        }
+
+        void disableAsync()
+        {
+            std::lock_guard lock(m_modeMutex);
+            stopWorker();
+        }
+
+        META_NODISCARD bool isAsync() const noexcept
+        {
+            return m_worker.load(std::memory_order_acquire) != nullptr;
+        }
+
+        // Messages discarded by the DropNewest / DropOldest overflow policies
+        META_NODISCARD size_t droppedCount() const noexcept
+        {
+            size_t dropped = m_droppedBefore.load();
+            withWorker([&](internal::LogWorker& worker) { dropped += worker.dropped(); });
+            return dropped;
         }
 
-        void setFile(const meta::String<>& filepath)
+        // Reports suppressed records, blocks until every message logged so far has reached the sinks, then flushes them
+        void flush()
         {
-            m_file = std::make_unique<std::ofstream>(filepath.c_str(), std::ios::app);
+            reportSuppressed();
+            withWorker([](internal::LogWorker& worker) { worker.waitIdle(); });
+            flushSinks();
+        }
+
+        // False when the level is compiled out (META_LOG_MIN_LEVEL) or below the runtime level
+        META_NODISCARD bool isEnabled(LogLevel level) const noexcept
+        {
+            return level >= MinCompiledLevel && level != LogLevel::Off &&
+                   m_level.load(std::memory_order_relaxed) <= level;
         }
 
         template <typename... Args> void debug(Args&&... args)
         {
-            if (m_level <= LogLevel::Debug)
-                log("DEBUG", std::cout, std::forward<Args>(args)...);
+            emit<LogLevel::Debug>(std::forward<Args>(args)...);
         }
 
         template <typename... Args> void info(Args&&... args)
         {
-            if (m_level <= LogLevel::Info)
-                log("INFO", std::cout, std::forward<Args>(args)...);
+            emit<LogLevel::Info>(std::forward<Args>(args)...);
         }
 
         template <typename... Args> void warning(Args&&... args)
         {
-            if (m_level <= LogLevel::Warning)
-                log("WARNING", std::cerr, std::forward<Args>(args)...);
+            emit<LogLevel::Warning>(std::forward<Args>(args)...);
         }
 
         template <typename... Args> void error(Args&&... args)
         {
-            if (m_level <= LogLevel::Error)
-                log("ERROR", std::cerr, std::forward<Args>(args)...);
+            emit<LogLevel::Error>(std::forward<Args>(args)...);
+        }
+
+        // The message is produced by calling func only when it will be emitted, e.g.
+        //   logger.logLazy<LogLevel::Debug>([&] { return meta::format("state: ", expensiveDump()); });
+        template <LogLevel Level, std::invocable Func> void logLazy(Func&& func)
+        {
+            if constexpr (Level >= MinCompiledLevel)
+            {
+                if (m_level.load(std::memory_order_relaxed) <= Level)
+                    log(Level, std::forward<Func>(func)());
+            }
         }
 
     private:
-        LogLevel m_level = LogLevel::Info;
-        bool m_includeTimestamps = false;
-        std::unique_ptr<std::ofstream> m_file;
+        // Settings may change while other threads log; each record reads every setting once
+        std::atomic<LogLevel> m_level{ LogLevel::Info };
+        std::atomic<bool> m_includeTimestamps{ false };
+        std::atomic<TimestampPrecision> m_timestampPrecision{ TimestampPrecision::Seconds };
+        std::atomic<bool> m_utcTimestamps{ false };
+        std::atomic<bool> m_includeThreadNames{ false };
+        std::atomic<bool> m_includeSequenceNumbers{ false };
+        std::atomic<uint64_t> m_sequence{ 0 };
+        std::atomic<int64_t> m_suppressionInterval{ 10000 }; // milliseconds
+        std::atomic<int64_t> m_nextSuppressionReport{ 0 };   // steady_clock ticks
+
+        mutable std::shared_mutex m_sinksMutex;
+        std::vector<std::shared_ptr<LogSink>> m_sinks;
+        std::shared_ptr<LogSink> m_fileSink; // the sink installed by setFile
 
-        template <typename... Args> void log(const meta::String<>& prefix, std::ostream& os, Args&&... args)
+        // The worker is owned through m_worker and only used inside withWorker(), which counts its users so that
+        // stopWorker() can wait for them instead of every record taking a lock
+        std::mutex m_modeMutex;                                // serializes enableAsync / disableAsync
+        std::atomic<internal::LogWorker*> m_worker{ nullptr }; // set in async mode
+        mutable std::atomic<uint32_t> m_workerUsers{ 0 };
+        std::atomic<size_t> m_droppedBefore{ 0 }; // drops counted by earlier async sessions
+
+        static constexpr std::string_view levelName(LogLevel level) noexcept
         {
-            meta::String<> message = meta::format(std::forward<Args>(args)...);
-            meta::String<> fullMessage;
+            switch (level)
+            {
+            case LogLevel::Debug:
+                return "DEBUG";
+            case LogLevel::Info:
+                return "INFO";
+            case LogLevel::Warning:
+                return "WARNING";
+            default:
+                return "ERROR";
+            }
+        }
 
-            if (m_includeTimestamps)
+        // Levels below META_LOG_MIN_LEVEL compile to nothing
+        template <LogLevel Level, typename... Args> void emit(Args&&... args)
+        {
+            if constexpr (Level >= MinCompiledLevel)
             {
-                fullMessage += "[" + currentTimestamp().toString() + "] ";
+                if (m_level.load(std::memory_order_relaxed) <= Level)
+                    log(Level, std::forward<Args>(args)...);
             }
+        }
 
-            fullMessage += "[" + prefix.toString() + "] " + message.toString();
+        template <typename... Args> void log(LogLevel level, Args&&... args)
+        {
+            bool queued = withWorker(
+                [&](internal::LogWorker& worker)
+                {
+                    LogMessage message;
+                    buildMessage(message, level, args...);
+                    worker.push(std::move(message));
+                });
+            if (queued)
+                return;
+
+            // Synchronous records are built in a per-thread buffer that keeps its capacity, so long lines don't
+            // allocate on every call. A sink that logs from inside write() re-enters here and gets a fresh record.
+            thread_local LogMessage buffer;
+            thread_local bool bufferInUse = false;
+            if (bufferInUse)
+            {
+                LogMessage message;
+                buildMessage(message, level, args...);
+                dispatch(message);
+                return;
+            }
 
-            os << fullMessage << "\n";
+            struct Release
+            {
+                bool& inUse;
+                ~Release()
+                {
+                    inUse = false;
+                }
+            } release{ bufferInUse };
+            bufferInUse = true;
 
-            if (m_file && m_file->is_open())
-                (*m_file) << fullMessage << "\n";
+            buffer.text.clear();
+            buildMessage(buffer, level, args...);
+            dispatch(buffer);
         }
 
-        meta::String<> currentTimestamp() const
+        template <typename... Args> void buildMessage(LogMessage& message, LogLevel level, const Args&... args)
         {
-            auto now = std::chrono::system_clock::now();
-            auto timeT = std::chrono::system_clock::to_time_t(now);
-            auto localTime = *std::localtime(&timeT);
+            const internal::ThreadInfo& thread = internal::currentThreadInfo();
+            message.level = level;
+            message.time = std::chrono::system_clock::now();
+            message.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+            message.threadId = thread.id;
+            message.threadName = thread.name;
+
+            if (m_includeSequenceNumbers.load(std::memory_order_relaxed))
+                meta::formatTo<"#{} ">(message.text, message.sequence);
 
-            std::ostringstream oss;
-            oss << std::put_time(&localTime, "%Y-%m-%d %H:%M:%S");
-            return meta::String<>(oss.str());
+            if (m_includeTimestamps.load(std::memory_order_relaxed))
+            {
+                char timestamp[TimestampCache::MaxLength];
+                size_t length = currentTimestamp(timestamp, message.time);
+                meta::formatTo<"[{}] ">(message.text, std::string_view(timestamp, length));
+            }
+
+            if (m_includeThreadNames.load(std::memory_order_relaxed))
+            {
+                if (thread.name.empty())
+                    meta::formatTo<"[thread {}] ">(message.text, thread.id);
+                else
+                    meta::formatTo<"[{}] ">(message.text, thread.name.view());
+            }
+
+            meta::formatTo<"[{}] ">(message.text, levelName(level));
+            meta::formatTo(message.text, args...);
+            message.text += '\n';
+        }
+
+        // Calls func with the async worker, if there is one, and returns whether there was. The users counter and the
+        // pointer are both sequentially consistent: either stopWorker() sees this call in m_workerUsers and waits for
+        // it, or this call sees the pointer already cleared. Callers arriving after that skip the counter entirely.
+        template <typename Func> bool withWorker(Func&& func) const
+        {
+            if (m_worker.load(std::memory_order_relaxed) == nullptr)
+                return false;
+
+            struct Use
+            {
+                std::atomic<uint32_t>& users;
+                ~Use()
+                {
+                    users.fetch_sub(1);
+                }
+            };
+
+            m_workerUsers.fetch_add(1);
+            Use use{ m_workerUsers };
+            internal::LogWorker* worker = m_worker.load();
+            if (worker == nullptr)
+                return false;
+            func(*worker);
+            return true;
+        }
+
+        // Caller holds m_modeMutex. Detaches the worker, waits until no caller still uses it, then lets it write out
+        // everything queued.
+        void stopWorker()
+        {
+            std::unique_ptr<internal::LogWorker> worker(m_worker.exchange(nullptr));
+            if (!worker)
+                return;
+
+            while (m_workerUsers.load() != 0)
+                std::this_thread::yield();
+            worker->stop();
+            m_droppedBefore.fetch_add(worker->dropped());
+        }
+
+        void dispatch(const LogMessage& message)
+        {
+            std::shared_lock lock(m_sinksMutex);
+            for (const auto& sink : m_sinks)
+                if (sink->accepts(message.level))
+                    sink->write(message);
+        }
+
+        void flushSinks()
+        {
+            std::shared_lock lock(m_sinksMutex);
+            for (const auto& sink : m_sinks)
+                sink->flush();
+        }
+
+        int64_t suppressionDeadline() const noexcept
+        {
+            auto interval = std::chrono::milliseconds(m_suppressionInterval.load(std::memory_order_relaxed));
+            return (std::chrono::steady_clock::now() + interval).time_since_epoch().count();
+        }
+
+        // One cache per thread, so concurrent loggers never share conversion state or take a lock
+        size_t currentTimestamp(char* out, std::chrono::system_clock::time_point now) const
+        {
+            thread_local TimestampCache cache;
+            return cache.format(out, now, m_timestampPrecision.load(std::memory_order_relaxed), m_utcTimestamps.load(std::memory_order_relaxed));
         }
     };
 } // namespace meta
+
+// Logging statements whose arguments are evaluated only when the message is emitted. Below META_LOG_MIN_LEVEL the
+// statement is compiled out entirely; otherwise the arguments are skipped while the runtime level filters it.
+#define META_LOG_AT(logger, level, method, ...)                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (META_LOG_MIN_LEVEL <= (level))                                                                   \
+        {                                                                                                              \
+            if ((logger).isEnabled(static_cast<::meta::LogLevel>(level)))                                              \
+                (logger).method(__VA_ARGS__);                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+// Like META_LOG_AT, but the statement only lets records through as allowed by limit (a meta::LogLimit, read on
+// the first call). Each statement keeps its own counters and belongs to the logger of its first call; suppressed
+// records are summarized periodically at the statement's level, e.g.
+//   META_LOG_ERROR_LIMITED(logger, meta::LogLimit::perSecondRate(5, 20), "request failed: ", status);
+#define META_LOG_LIMITED(logger, level, method, limit, ...)                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (META_LOG_MIN_LEVEL <= (level))                                                                   \
+        {                                                                                                              \
+            if ((logger).isEnabled(static_cast<::meta::LogLevel>(level)))                                              \
+            {                                                                                                          \
+                static ::meta::LogSite metaLogSite(__FILE__, __LINE__, limit, &(logger),                               \
+                                                   static_cast<::meta::LogLevel>(level));                              \
+                auto metaLogDecision = metaLogSite.admit();                                                            \
+                if (metaLogDecision == ::meta::LogSite::Decision::Admit)                                               \
+                    (logger).method(__VA_ARGS__);                                                                      \
+                if (metaLogDecision != ::meta::LogSite::Decision::Suppress)                                            \
+                    (logger).reportSuppressedIfDue();                                                                  \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+#define META_LOG_DEBUG(logger, ...) META_LOG_AT(logger, META_LOG_LEVEL_DEBUG, debug, __VA_ARGS__)
+#define META_LOG_INFO(logger, ...) META_LOG_AT(logger, META_LOG_LEVEL_INFO, info, __VA_ARGS__)
+#define META_LOG_WARNING(logger, ...) META_LOG_AT(logger, META_LOG_LEVEL_WARNING, warning, __VA_ARGS__)
+#define META_LOG_ERROR(logger, ...) META_LOG_AT(logger, META_LOG_LEVEL_ERROR, error, __VA_ARGS__)
+
+#define META_LOG_DEBUG_LIMITED(logger, limit, ...)                                                                     \
+    META_LOG_LIMITED(logger, META_LOG_LEVEL_DEBUG, debug, limit, __VA_ARGS__)
+#define META_LOG_INFO_LIMITED(logger, limit, ...)                                                                      \
+    META_LOG_LIMITED(logger, META_LOG_LEVEL_INFO, info, limit, __VA_ARGS__)
+#define META_LOG_WARNING_LIMITED(logger, limit, ...)                                                                   \
+    META_LOG_LIMITED(logger, META_LOG_LEVEL_WARNING, warning, limit, __VA_ARGS__)
+#define META_LOG_ERROR_LIMITED(logger, limit, ...)                                                                     \
+    META_LOG_LIMITED(logger, META_LOG_LEVEL_ERROR, error, limit, __VA_ARGS__)
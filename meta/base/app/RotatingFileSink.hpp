@@ -0,0 +1,429 @@
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <meta/base/app/LogSink.hpp>
+#include <meta/base/core/ConsoleOutput.hpp>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/String.hpp>
+#include <meta/base/filesystem/Path.hpp>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#if defined(META_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace meta
+{
+    // Compresses a completed segment in place, replacing the file with <segment><compressedSuffix>.
+    // Returns false when the segment was left as it is.
+    using SegmentCompressor = std::function<bool(const Path& segment)>;
+
+    struct RotationOptions
+    {
+        size_t maxBytes = 0;                // start a new segment before one would grow past this; 0 = no limit
+        std::chrono::seconds interval{ 0 }; // also start one at every multiple of this since the epoch; 0 = never
+        size_t maxFiles = 5;                // completed segments kept as path.1 (newest) .. path.<maxFiles>
+        size_t preallocateBytes = 0;        // disk space reserved for each segment up front; 0 = maxBytes
+        size_t bufferSize = 256 * 1024;     // output collected before each write(2)
+        SegmentCompressor compressor = {};  // applied to every completed segment on the background thread
+        std::string_view compressedSuffix = ".gz";
+    };
+
+    namespace internal
+    {
+        META_INLINE int openLogSegment(const char* path) noexcept
+        {
+#if defined(META_PLATFORM_WINDOWS)
+            return _open(path, _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+            return ::open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+        }
+
+        META_INLINE size_t logSegmentSize(int fd) noexcept
+        {
+#if defined(META_PLATFORM_WINDOWS)
+            struct _stat64 info{};
+            return _fstat64(fd, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+#else
+            struct stat info{};
+            return ::fstat(fd, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+#endif
+        }
+
+        // Reserves blocks without changing the file size, so appends never wait on block allocation
+        META_INLINE void preallocateLogSegment(int fd, size_t bytes) noexcept
+        {
+#if defined(META_PLATFORM_LINUX)
+            if (bytes > 0)
+                ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(bytes));
+#else
+            (void)fd;
+            (void)bytes;
+#endif
+        }
+
+        // Releases blocks reserved past the end of the data, then closes
+        META_INLINE void closeLogSegment(int fd) noexcept
+        {
+#if defined(META_PLATFORM_WINDOWS)
+            _close(fd);
+#else
+#if defined(META_PLATFORM_LINUX)
+            ::ftruncate(fd, static_cast<off_t>(logSegmentSize(fd)));
+#endif
+            ::close(fd);
+#endif
+        }
+    } // namespace internal
+
+    // SegmentCompressor that runs the system gzip; returns false when gzip is not available
+    META_INLINE bool gzipLogSegment(const Path& segment)
+    {
+#if defined(META_PLATFORM_WINDOWS)
+        (void)segment;
+        return false;
+#else
+        char program[] = "gzip";
+        char force[] = "-f";
+        char quiet[] = "-q";
+        char* argv[] = { program, force, quiet, const_cast<char*>(segment.c_str()), nullptr };
+        char* environment[] = { nullptr }; // gzip needs none; it is still found through this process's PATH
+
+        pid_t pid = 0;
+        if (::posix_spawnp(&pid, program, nullptr, nullptr, argv, environment) != 0)
+            return false;
+
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0)
+        {
+            if (errno != EINTR)
+                return false;
+        }
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+    }
+
+    // Writes to path and starts a new segment on a size or time boundary, keeping completed segments as
+    // path.1 .. path.<maxFiles>. The hot path only copies into an aligned buffer; the next segment is opened and
+    // preallocated ahead of time as path.next by a background thread, so rotating is a descriptor swap. Closing,
+    // renaming and compressing the completed segment happen on the same thread. If the next segment isn't ready yet,
+    // the current one keeps growing until it is. If path cannot be opened, the failure is reported on stderr, messages
+    // are dropped (see droppedCount) and opening is retried at most once per second.
+    class RotatingFileSink : public LogSink
+    {
+    public:
+        static constexpr size_t BufferAlignment = 4096;
+
+        RotatingFileSink(const Path& path, size_t maxBytes, size_t maxFiles = 5)
+            : RotatingFileSink(path, RotationOptions{ .maxBytes = maxBytes, .maxFiles = maxFiles })
+        {
+        }
+
+        RotatingFileSink(const Path& path, RotationOptions options) : m_path(path), m_options(std::move(options))
+        {
+            if (m_options.bufferSize < BufferAlignment)
+                m_options.bufferSize = BufferAlignment;
+            void* buffer = ::operator new[](m_options.bufferSize, std::align_val_t{ BufferAlignment });
+            m_buffer.reset(static_cast<char*>(buffer));
+
+            auto now = std::chrono::system_clock::now();
+            openSegment(now);
+            m_nextBoundary = boundaryAfter(now);
+            m_thread = std::thread([this] { run(); });
+        }
+
+        RotatingFileSink(const RotatingFileSink&) = delete;
+        RotatingFileSink& operator=(const RotatingFileSink&) = delete;
+
+        ~RotatingFileSink() override
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                flushBuffer();
+            }
+            {
+                std::lock_guard lock(m_jobMutex);
+                m_stopping = true;
+            }
+            m_jobCondition.notify_one();
+            m_thread.join();
+
+            if (m_fd >= 0)
+                internal::closeLogSegment(m_fd);
+        }
+
+        META_NODISCARD bool isOpen() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_fd >= 0;
+        }
+
+        void write(const LogMessage& message) override
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_fd < 0)
+            {
+                if (message.time < m_nextOpenAttempt || (openSegment(message.time), m_fd < 0))
+                {
+                    ++m_dropped;
+                    return;
+                }
+            }
+
+            size_t size = message.text.size();
+            bool sizeReached = m_options.maxBytes > 0 && m_segmentSize > 0 && m_segmentSize + size > m_options.maxBytes;
+            if (sizeReached || message.time >= m_nextBoundary)
+                rotate(message.time);
+
+            append(message.text.data(), size);
+        }
+
+        void flush() override
+        {
+            std::lock_guard lock(m_mutex);
+            flushBuffer();
+        }
+
+        // Messages discarded while the file could not be opened
+        META_NODISCARD size_t droppedCount() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_dropped;
+        }
+
+    private:
+        struct AlignedDelete
+        {
+            void operator()(char* data) const noexcept
+            {
+                ::operator delete[](data, std::align_val_t{ BufferAlignment });
+            }
+        };
+
+        Path m_path;
+        RotationOptions m_options;
+
+        // Writer state
+        mutable std::mutex m_mutex;
+        std::unique_ptr<char[], AlignedDelete> m_buffer;
+        size_t m_used = 0;
+        int m_fd = -1;
+        size_t m_segmentSize = 0;
+        std::chrono::system_clock::time_point m_nextBoundary;
+        std::chrono::system_clock::time_point m_nextOpenAttempt; // while path cannot be opened
+        bool m_openFailed = false;
+        size_t m_dropped = 0;
+
+        // Hand-off with the background thread
+        std::mutex m_jobMutex;
+        std::condition_variable m_jobCondition;
+        int m_spareFd = -1;
+        size_t m_spareSize = 0;
+        int m_retiredFd = -1;
+        bool m_compressPending = false;
+        bool m_stopping = false;
+        std::thread m_thread;
+
+        META_NODISCARD size_t preallocateSize() const noexcept
+        {
+            return m_options.preallocateBytes > 0 ? m_options.preallocateBytes : m_options.maxBytes;
+        }
+
+        META_NODISCARD std::chrono::system_clock::time_point boundaryAfter(
+            std::chrono::system_clock::time_point time) const noexcept
+        {
+            if (m_options.interval.count() <= 0)
+                return std::chrono::system_clock::time_point::max();
+
+            auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch());
+            return std::chrono::system_clock::time_point((elapsed / m_options.interval + 1) * m_options.interval);
+        }
+
+        META_NODISCARD String<> segmentName(size_t index, std::string_view suffix = {}) const
+        {
+            return meta::format(m_path, '.', index, suffix);
+        }
+
+        META_NODISCARD String<> spareName() const
+        {
+            return meta::format(m_path, ".next");
+        }
+
+        // Caller holds m_mutex (or is the constructor). Opens path; reports the first failure and the recovery.
+        void openSegment(std::chrono::system_clock::time_point time)
+        {
+            m_fd = internal::openLogSegment(m_path.c_str());
+            if (m_fd < 0)
+            {
+                m_nextOpenAttempt = time + std::chrono::seconds(1);
+                if (!m_openFailed)
+                    meta::errorln("RotatingFileSink: cannot open '", m_path, "': ", std::strerror(errno),
+                                  "; retrying every second");
+                m_openFailed = true;
+                return;
+            }
+
+            m_segmentSize = internal::logSegmentSize(m_fd);
+            internal::preallocateLogSegment(m_fd, preallocateSize());
+            if (m_openFailed)
+                meta::errorln("RotatingFileSink: opened '", m_path, "' after dropping ", m_dropped, " messages");
+            m_openFailed = false;
+        }
+
+        // Caller holds m_mutex
+        void flushBuffer() noexcept
+        {
+            if (m_used > 0 && m_fd >= 0)
+                internal::writeFd(m_fd, m_buffer.get(), m_used);
+            m_used = 0;
+        }
+
+        // Caller holds m_mutex
+        void append(const char* data, size_t size) noexcept
+        {
+            m_segmentSize += size;
+            if (m_used + size > m_options.bufferSize)
+            {
+                flushBuffer();
+                if (size >= m_options.bufferSize)
+                {
+                    internal::writeFd(m_fd, data, size);
+                    return;
+                }
+            }
+            std::memcpy(m_buffer.get() + m_used, data, size);
+            m_used += size;
+        }
+
+        // Caller holds m_mutex. Switches to the spare segment if the background thread has one ready.
+        void rotate(std::chrono::system_clock::time_point time)
+        {
+            {
+                std::lock_guard lock(m_jobMutex);
+                if (m_spareFd < 0 || m_retiredFd >= 0)
+                    return;
+
+                flushBuffer();
+                m_retiredFd = m_fd;
+                m_fd = std::exchange(m_spareFd, -1);
+                m_segmentSize = m_spareSize;
+            }
+            m_jobCondition.notify_one();
+            m_nextBoundary = boundaryAfter(time);
+        }
+
+        void run()
+        {
+            std::unique_lock lock(m_jobMutex);
+            while (true)
+            {
+                if (m_retiredFd >= 0 && !m_compressPending)
+                {
+                    int fd = m_retiredFd;
+                    lock.unlock();
+                    internal::closeLogSegment(fd);
+                    shiftSegments();
+                    lock.lock();
+                    m_retiredFd = -1;
+                    m_compressPending = static_cast<bool>(m_options.compressor) && m_options.maxFiles > 0;
+                    continue;
+                }
+
+                // The next segment is prepared before compressing so rotation never waits on the compressor
+                if (m_spareFd < 0 && !m_stopping)
+                {
+                    lock.unlock();
+                    String<> name = spareName();
+                    int fd = internal::openLogSegment(name.c_str());
+                    size_t size = 0;
+                    if (fd >= 0)
+                    {
+                        size = internal::logSegmentSize(fd);
+                        internal::preallocateLogSegment(fd, preallocateSize());
+                    }
+                    lock.lock();
+
+                    if (fd < 0)
+                    {
+                        // Retry later rather than spinning on a persistent error
+                        m_jobCondition.wait_for(lock, std::chrono::seconds(1));
+                        if (!m_stopping)
+                            continue;
+                    }
+                    m_spareFd = fd;
+                    m_spareSize = size;
+                    continue;
+                }
+
+                if (m_compressPending)
+                {
+                    lock.unlock();
+                    m_options.compressor(Path(segmentName(1)));
+                    lock.lock();
+                    m_compressPending = false;
+                    continue;
+                }
+
+                if (m_stopping)
+                    break;
+                m_jobCondition.wait(lock);
+            }
+
+            // An unused spare is empty unless left over from an earlier run
+            if (m_spareFd >= 0)
+            {
+                bool empty = internal::logSegmentSize(m_spareFd) == 0;
+                internal::closeLogSegment(m_spareFd);
+                if (empty)
+                    std::remove(spareName().c_str());
+                m_spareFd = -1;
+            }
+        }
+
+        // path -> path.1 -> ... -> path.<maxFiles>; the spare the writer switched to becomes path
+        void shiftSegments()
+        {
+            std::string_view suffix = m_options.compressedSuffix;
+            size_t maxFiles = m_options.maxFiles;
+            if (maxFiles > 0)
+            {
+                bool compressed = static_cast<bool>(m_options.compressor);
+                std::remove(segmentName(maxFiles).c_str());
+                if (compressed)
+                    std::remove(segmentName(maxFiles, suffix).c_str());
+                for (size_t i = maxFiles; i > 1; --i)
+                {
+                    std::rename(segmentName(i - 1).c_str(), segmentName(i).c_str());
+                    if (compressed)
+                        std::rename(segmentName(i - 1, suffix).c_str(), segmentName(i, suffix).c_str());
+                }
+                std::rename(m_path.c_str(), segmentName(1).c_str());
+            }
+            else
+            {
+                std::remove(m_path.c_str());
+            }
+            std::rename(spareName().c_str(), m_path.c_str());
+        }
+    };
+} // namespace meta
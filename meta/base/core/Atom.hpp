@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/String.hpp>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace meta
+{
+    namespace internal
+    {
+        struct AtomEntry
+        {
+            std::string text;
+            size_t hash;
+            uint32_t id;
+        };
+
+        // Process-wide intern table. Entries are never removed and live in a deque, so their addresses are stable.
+        class AtomTable
+        {
+        public:
+            static AtomTable& instance()
+            {
+                static AtomTable table;
+                return table;
+            }
+
+            const AtomEntry* intern(std::string_view text)
+            {
+                if (text.empty())
+                    return nullptr;
+
+                {
+                    std::shared_lock lock(m_mutex);
+                    auto it = m_lookup.find(text);
+                    if (it != m_lookup.end())
+                        return it->second;
+                }
+
+                std::unique_lock lock(m_mutex);
+                auto it = m_lookup.find(text);
+                if (it != m_lookup.end())
+                    return it->second;
+
+                // Id 0 is reserved for the empty atom
+                auto id = static_cast<uint32_t>(m_entries.size() + 1);
+                const AtomEntry& entry = m_entries.emplace_back(AtomEntry{ std::string(text), hashString(text), id });
+                m_lookup.emplace(std::string_view(entry.text), &entry);
+                return &entry;
+            }
+
+            size_t size() const
+            {
+                std::shared_lock lock(m_mutex);
+                return m_entries.size();
+            }
+
+        private:
+            AtomTable() = default;
+
+            struct TextHash
+            {
+                size_t operator()(std::string_view text) const noexcept
+                {
+                    return hashString(text);
+                }
+            };
+
+            mutable std::shared_mutex m_mutex;
+            std::deque<AtomEntry> m_entries;
+            std::unordered_map<std::string_view, const AtomEntry*, TextHash> m_lookup;
+        };
+    } // namespace internal
+
+    // Interned string. Each distinct text maps to one table entry for the lifetime of the process, so atoms compare
+    // by pointer and carry their hash and a stable 32-bit id. The default atom is the empty string with id 0.
+    class Atom
+    {
+    public:
+        META_INLINE Atom() noexcept = default;
+
+        META_INLINE explicit Atom(std::string_view text) : m_entry(internal::AtomTable::instance().intern(text))
+        {
+        }
+
+        META_INLINE explicit Atom(const char* text) : Atom(std::string_view(text))
+        {
+        }
+
+        template <size_t N> META_INLINE explicit Atom(const String<N>& text) : Atom(std::string_view(text))
+        {
+        }
+
+        META_NODISCARD META_INLINE uint32_t id() const noexcept
+        {
+            return m_entry ? m_entry->id : 0;
+        }
+
+        META_NODISCARD META_INLINE size_t hash() const noexcept
+        {
+            return m_entry ? m_entry->hash : hashString({});
+        }
+
+        META_NODISCARD META_INLINE std::string_view view() const noexcept
+        {
+            return m_entry ? std::string_view(m_entry->text) : std::string_view();
+        }
+
+        META_NODISCARD META_INLINE const char* c_str() const noexcept
+        {
+            return m_entry ? m_entry->text.c_str() : "";
+        }
+
+        META_NODISCARD META_INLINE size_t size() const noexcept
+        {
+            return view().size();
+        }
+
+        META_NODISCARD META_INLINE bool empty() const noexcept
+        {
+            return m_entry == nullptr;
+        }
+
+        META_NODISCARD META_INLINE operator std::string_view() const noexcept
+        {
+            return view();
+        }
+
+        friend bool operator==(const Atom& lhs, const Atom& rhs) noexcept
+        {
+            return lhs.m_entry == rhs.m_entry;
+        }
+
+        friend bool operator==(const Atom& lhs, std::string_view rhs) noexcept
+        {
+            return lhs.view() == rhs;
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const Atom& atom)
+        {
+            return os << atom.view();
+        }
+
+    private:
+        const internal::AtomEntry* m_entry = nullptr;
+    };
+
+    // Transparent hash for containers keyed by Atom: lookups by plain text hash the text the same way an Atom does,
+    // so they work without interning the key first. Use together with std::equal_to<>.
+    struct AtomHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(const Atom& atom) const noexcept
+        {
+            return atom.hash();
+        }
+
+        size_t operator()(std::string_view text) const noexcept
+        {
+            return hashString(text);
+        }
+    };
+} // namespace meta
+
+namespace std
+{
+    template <> struct hash<meta::Atom>
+    {
+        size_t operator()(const meta::Atom& atom) const noexcept
+        {
+            return atom.hash();
+        }
+    };
+} // namespace std
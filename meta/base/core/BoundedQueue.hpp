@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <meta/base/core/Platform.hpp>
+#include <new>
+#include <utility>
+
+namespace meta
+{
+    // Size of a cache line, used to keep producer and consumer counters from sharing one
+    inline constexpr size_t CacheLineSize = 64;
+
+    // Bounded lock-free ring (Vyukov). Each cell carries a sequence number that tells producers and consumers whether
+    // it is free or filled, so neither side takes a lock and a full or empty queue is detected without blocking.
+    // Any number of threads may push and pop; the capacity is rounded up to a power of two.
+    template <typename T> class BoundedQueue
+    {
+    public:
+        META_INLINE explicit BoundedQueue(size_t capacity)
+            : m_capacity(std::bit_ceil(capacity < 2 ? size_t(2) : capacity)), m_mask(m_capacity - 1),
+              m_cells(std::make_unique<Cell[]>(m_capacity))
+        {
+            for (size_t i = 0; i < m_capacity; ++i)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedQueue(const BoundedQueue&) = delete;
+        BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+        // Returns false (and leaves value untouched) when the queue is full
+        template <typename U> META_INLINE bool tryPush(U&& value)
+        {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            for (;;)
+            {
+                cell = &m_cells[pos & m_mask];
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = std::forward<U>(value);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Returns false when the queue is empty
+        META_INLINE bool tryPop(T& out)
+        {
+            size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            for (;;)
+            {
+                cell = &m_cells[pos & m_mask];
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            out = std::move(cell->value);
+            cell->sequence.store(pos + m_capacity, std::memory_order_release);
+            return true;
+        }
+
+        META_NODISCARD META_INLINE size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        // Approximate while other threads are pushing or popping
+        META_NODISCARD META_INLINE size_t size() const noexcept
+        {
+            size_t head = m_dequeuePos.load(std::memory_order_relaxed);
+            size_t tail = m_enqueuePos.load(std::memory_order_relaxed);
+            return tail >= head ? tail - head : 0;
+        }
+
+        META_NODISCARD META_INLINE bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T value{};
+        };
+
+        size_t m_capacity;
+        size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        alignas(CacheLineSize) std::atomic<size_t> m_enqueuePos{ 0 };
+        alignas(CacheLineSize) std::atomic<size_t> m_dequeuePos{ 0 };
+    };
+} // namespace meta
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <meta/base/core/Platform.hpp>
+#include <thread>
+
+#if defined(META_ARCH_X64)
+#include <immintrin.h>
+#if defined(META_COMPILER_MSVC)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
+// Clocks usable as the Clock parameter of Timer and ScopeTimer. Any std::chrono clock works; TscClock below reads the
+// CPU's cycle counter instead of asking the OS.
+namespace meta
+{
+    namespace internal
+    {
+        // Raw cycle counter: the TSC on x86-64, the generic timer on ARM64, 0 elsewhere
+        META_FORCE_INLINE uint64_t readCycleCounter() noexcept
+        {
+#if defined(META_ARCH_X64)
+            return __rdtsc();
+#elif defined(META_ARCH_ARM64) && !defined(META_COMPILER_MSVC)
+            uint64_t value;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+            return value;
+#else
+            return 0;
+#endif
+        }
+
+        // Whether the cycle counter ticks at a fixed rate regardless of frequency scaling and sleep states
+        META_INLINE bool hasInvariantCycleCounter() noexcept
+        {
+#if defined(META_ARCH_X64) && defined(META_COMPILER_MSVC)
+            int info[4];
+            __cpuid(info, 0x80000000);
+            if (static_cast<unsigned>(info[0]) < 0x80000007u)
+                return false;
+            __cpuid(info, 0x80000007);
+            return (info[3] & (1 << 8)) != 0;
+#elif defined(META_ARCH_X64)
+            unsigned eax, ebx, ecx, edx;
+            if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+                return false;
+            return (edx & (1u << 8)) != 0;
+#elif defined(META_ARCH_ARM64) && !defined(META_COMPILER_MSVC)
+            return true; // the generic timer runs at a fixed frequency by design
+#else
+            return false;
+#endif
+        }
+
+        struct CycleCounterCalibration
+        {
+            bool usable = false;
+            double nanosPerTick = 0.0;
+            uint64_t baseTicks = 0;
+            int64_t baseNanos = 0; // steady_clock time at baseTicks
+        };
+
+        // Compares the cycle counter against steady_clock across a sleep of at least CalibrationNanos. Only the two
+        // samples need to be tight, so the thread doesn't have to spin in between.
+        META_INLINE CycleCounterCalibration calibrateCycleCounter() noexcept
+        {
+            constexpr int64_t CalibrationNanos = 5'000'000;
+
+            CycleCounterCalibration calibration;
+            if (!hasInvariantCycleCounter())
+                return calibration;
+
+            auto steadyNanos = []
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+            };
+
+            // Reads the counter between two clock reads and keeps the tightest of a few tries
+            auto sample = [&](int64_t& nanos, uint64_t& ticks)
+            {
+                int64_t window = INT64_MAX;
+                for (int i = 0; i < 5; ++i)
+                {
+                    int64_t before = steadyNanos();
+                    uint64_t counter = readCycleCounter();
+                    int64_t after = steadyNanos();
+                    if (after - before < window)
+                    {
+                        window = after - before;
+                        nanos = before + window / 2;
+                        ticks = counter;
+                    }
+                }
+            };
+
+            int64_t startNanos = 0, endNanos = 0;
+            uint64_t startTicks = 0, endTicks = 0;
+            sample(startNanos, startTicks);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(CalibrationNanos));
+            sample(endNanos, endTicks);
+
+            if (endTicks <= startTicks)
+                return calibration;
+
+            calibration.usable = true;
+            calibration.nanosPerTick =
+                static_cast<double>(endNanos - startNanos) / static_cast<double>(endTicks - startTicks);
+            calibration.baseTicks = endTicks;
+            calibration.baseNanos = endNanos;
+            return calibration;
+        }
+
+        // Calibration shared by every TscClock. Constant-initialized, so now() reads it without a static guard.
+        struct CycleCounterState
+        {
+            std::atomic<bool> started{ false };
+            std::atomic<bool> finished{ false };
+            // Set once a usable calibration has been measured; until then now() reads steady_clock
+            std::atomic<const CycleCounterCalibration*> ready{ nullptr };
+            CycleCounterCalibration calibration;
+        };
+
+        inline CycleCounterState cycleCounterState;
+
+        META_INLINE void runCycleCounterCalibration() noexcept
+        {
+            CycleCounterState& state = cycleCounterState;
+            state.calibration = calibrateCycleCounter();
+            if (state.calibration.usable)
+                state.ready.store(&state.calibration, std::memory_order_release);
+            state.finished.store(true, std::memory_order_release);
+            state.finished.notify_all();
+        }
+
+        // Calibrates on a background thread the first time it is called; later calls return right away. If the
+        // thread can't be started the clock stays on steady_clock.
+        META_INLINE void startCycleCounterCalibration() noexcept
+        {
+            CycleCounterState& state = cycleCounterState;
+            if (state.started.load(std::memory_order_relaxed) || state.started.exchange(true))
+                return;
+            try
+            {
+                std::thread(runCycleCounterCalibration).detach();
+            }
+            catch (...)
+            {
+                state.finished.store(true, std::memory_order_release);
+                state.finished.notify_all();
+            }
+        }
+    } // namespace internal
+
+    // Monotonic clock that reads the invariant TSC (the generic timer on ARM64) and scales it to nanoseconds, without
+    // a system call or vDSO. Its readings line up with steady_clock's. The rate is measured against steady_clock over
+    // about 5 ms on a background thread, started by calibrateInBackground() (gui::Window does this) or else by the
+    // first now(); until it is known now() returns steady_clock. Without an invariant counter (old CPUs, some VMs,
+    // other architectures) now() stays on steady_clock.
+    class TscClock
+    {
+    public:
+        using rep = int64_t;
+        using period = std::nano;
+        using duration = std::chrono::nanoseconds;
+        using time_point = std::chrono::time_point<TscClock>;
+
+        static constexpr bool is_steady = true;
+
+        META_FORCE_INLINE static time_point now() noexcept
+        {
+            const auto* calibration = internal::cycleCounterState.ready.load(std::memory_order_acquire);
+            if (calibration)
+            {
+                auto ticks = static_cast<int64_t>(internal::readCycleCounter() - calibration->baseTicks);
+                auto nanos = static_cast<int64_t>(static_cast<double>(ticks) * calibration->nanosPerTick);
+                return time_point(duration(calibration->baseNanos + nanos));
+            }
+            internal::startCycleCounterCalibration();
+            return time_point(
+                std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()));
+        }
+
+        // Starts measuring the rate without waiting for it; call early at startup
+        static void calibrateInBackground() noexcept
+        {
+            internal::startCycleCounterCalibration();
+        }
+
+        // Blocks until the rate is known (or known to be unusable)
+        static void calibrate() noexcept
+        {
+            internal::startCycleCounterCalibration();
+            internal::cycleCounterState.finished.wait(false, std::memory_order_acquire);
+        }
+
+        // False while now() falls back to steady_clock, including before calibration has finished
+        META_NODISCARD static bool usesCycleCounter() noexcept
+        {
+            return internal::cycleCounterState.ready.load(std::memory_order_acquire) != nullptr;
+        }
+    };
+} // namespace meta
@@ -0,0 +1,298 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <meta/base/core/EventLoop.hpp>
+#include <meta/base/core/Signal.hpp>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace meta
+{
+    namespace internal
+    {
+        // Target of a queued connection, shared by its forwarder, the calls it has posted and the signal's slot node,
+        // which clears connected on disconnect so calls already posted are skipped
+        template <typename SlotType> struct QueuedSlot
+        {
+            explicit QueuedSlot(SlotType&& function) : slot(std::move(function))
+            {
+            }
+
+            SlotType slot;
+            std::atomic<bool> connected{ true };
+        };
+
+        // Owned by the forwarder; destroying the forwarder disconnects the target
+        template <typename SlotType> struct QueuedGuard
+        {
+            explicit QueuedGuard(std::shared_ptr<QueuedSlot<SlotType>> slot) : target(std::move(slot))
+            {
+            }
+
+            ~QueuedGuard()
+            {
+                target->connected.store(false, std::memory_order_release);
+            }
+
+            std::shared_ptr<QueuedSlot<SlotType>> target;
+        };
+
+        // Slot of a queued connection: copies the arguments and posts the call of the real slot to loop
+        template <typename SlotType, typename... Args>
+        auto queuedForwarder(std::shared_ptr<QueuedSlot<SlotType>> target, EventLoop& loop)
+        {
+            auto guard = std::make_shared<QueuedGuard<SlotType>>(target);
+            return [target, guard, &loop](Args... args)
+            {
+                loop.post(
+                    [target, values = std::tuple<std::decay_t<Args>...>(args...)]
+                    {
+                        if (target->connected.load(std::memory_order_acquire))
+                            std::apply(target->slot, values);
+                    });
+            };
+        }
+    } // namespace internal
+
+    // Signal that may be emitted, connected and disconnected from any thread at once. emit() registers as a reader
+    // and calls through the current immutable slot list without locking; connect() and disconnect() copy the list,
+    // change the copy and publish it, serialized among themselves. Replaced lists are freed once no reader can still
+    // see them (two-phase epochs), without writers ever waiting for readers, so slots may connect and disconnect
+    // freely; the change affects later emissions. A slot may be called concurrently from several emitting threads,
+    // and may still run once on a thread whose emit() started before disconnect() returned.
+    template <typename... Args> class ConcurrentSignal
+    {
+    public:
+        using SlotType = typename Signal<Args...>::SlotType;
+
+    private:
+        struct State;
+
+    public:
+        // Refers to one slot; disconnecting twice or after the signal is gone is a no-op
+        class Connection
+        {
+        public:
+            Connection() = default;
+
+            Connection(std::weak_ptr<State> state, uint64_t id) : state(std::move(state)), id(id)
+            {
+            }
+
+            void disconnect()
+            {
+                if (auto target = state.lock())
+                    target->disconnect(id);
+                state.reset();
+            }
+
+        private:
+            std::weak_ptr<State> state;
+            uint64_t id = 0;
+        };
+
+        ConcurrentSignal() : m_state(std::make_shared<State>())
+        {
+        }
+
+        ConcurrentSignal(const ConcurrentSignal&) = delete;
+        ConcurrentSignal& operator=(const ConcurrentSignal&) = delete;
+
+        template <typename Func>
+            requires std::invocable<std::decay_t<Func>&, Args...>
+        Connection connect(Func&& slot)
+        {
+            return Connection(m_state, m_state->connect(SlotType::fitOrBox(std::forward<Func>(slot))));
+        }
+
+        // Queued connection: emit() copies the arguments and posts the call to loop, so the slot runs on the thread
+        // that drains it (e.g. a widget updated from a worker thread runs on the GUI thread). A call still queued when
+        // the connection is dropped is skipped, including one posted by an emit() still running on another thread.
+        // The loop must outlive the connection.
+        template <typename Func>
+            requires std::invocable<std::decay_t<Func>&, Args...>
+        Connection connect(Func&& slot, EventLoop& loop)
+        {
+            auto target =
+                std::make_shared<internal::QueuedSlot<SlotType>>(SlotType::fitOrBox(std::forward<Func>(slot)));
+            std::shared_ptr<std::atomic<bool>> queued(target, &target->connected);
+            uint64_t id = m_state->connect(
+                SlotType::fitOrBox(internal::queuedForwarder<SlotType, Args...>(std::move(target), loop)),
+                std::move(queued));
+            return Connection(m_state, id);
+        }
+
+        void emit(Args... args)
+        {
+            typename State::ReadScope scope(*m_state);
+            for (const auto& node : *scope.slots)
+            {
+                if (node->connected.load(std::memory_order_relaxed))
+                    node->function(args...);
+            }
+        }
+
+        void operator()(Args... args)
+        {
+            emit(args...);
+        }
+
+        META_NODISCARD size_t slotCount()
+        {
+            typename State::ReadScope scope(*m_state);
+            return scope.slots->size();
+        }
+
+    private:
+        struct SlotNode
+        {
+            template <typename Func> explicit SlotNode(Func&& slot) : function(std::forward<Func>(slot))
+            {
+            }
+
+            SlotType function;
+            uint64_t id = 0;
+            std::atomic<bool> connected{ true }; // cleared first, so snapshots still in use skip the slot
+            std::shared_ptr<std::atomic<bool>> queued; // QueuedSlot::connected of a queued connection
+        };
+
+        using SlotList = std::vector<std::shared_ptr<SlotNode>>;
+
+        struct RetiredList
+        {
+            const SlotList* slots;
+            uint64_t epoch; // epoch when it was replaced
+        };
+
+        // Shared with the connections, which only hold it weakly
+        struct State
+        {
+            // Registers an emit() in the counter of the current epoch. Readers that raced with an epoch change retry,
+            // so a registered reader's epoch is never more than one behind the current one.
+            struct ReadScope
+            {
+                explicit ReadScope(State& owner) : state(owner)
+                {
+                    for (;;)
+                    {
+                        epoch = state.epoch.load();
+                        state.readers[epoch & 1].fetch_add(1);
+                        if (state.epoch.load() == epoch)
+                            break;
+                        state.readers[epoch & 1].fetch_sub(1);
+                    }
+                    slots = state.slots.load();
+                }
+
+                ~ReadScope()
+                {
+                    state.readers[epoch & 1].fetch_sub(1);
+                    if (state.hasRetired.load(std::memory_order_relaxed))
+                    {
+                        std::unique_lock lock(state.writeMutex, std::try_to_lock);
+                        if (lock)
+                            state.reclaim();
+                    }
+                }
+
+                State& state;
+                const SlotList* slots = nullptr;
+                uint64_t epoch = 0;
+            };
+
+            // All atomics below use sequential consistency: the reader protocol relies on store-load ordering
+            std::atomic<const SlotList*> slots{ new SlotList() };
+            std::atomic<uint64_t> epoch{ 0 };
+            std::atomic<uint32_t> readers[2] = {}; // active emit() calls per epoch parity
+            std::atomic<bool> hasRetired{ false };
+
+            std::mutex writeMutex; // guards everything below
+            std::vector<RetiredList> retired;
+            uint64_t lastId = 0;
+
+            ~State()
+            {
+                delete slots.load();
+                for (auto& list : retired)
+                    delete list.slots;
+            }
+
+            template <typename Func> uint64_t connect(Func&& slot, std::shared_ptr<std::atomic<bool>> queued = {})
+            {
+                auto node = std::make_shared<SlotNode>(std::forward<Func>(slot));
+                node->queued = std::move(queued);
+
+                std::lock_guard lock(writeMutex);
+                node->id = ++lastId;
+                auto* next = new SlotList(*slots.load());
+                next->push_back(std::move(node));
+                publish(next);
+                return lastId;
+            }
+
+            void disconnect(uint64_t id)
+            {
+                std::lock_guard lock(writeMutex);
+                const SlotList& current = *slots.load();
+
+                auto next = std::make_unique<SlotList>();
+                next->reserve(current.size());
+                for (const auto& node : current)
+                {
+                    if (node->id == id)
+                    {
+                        node->connected.store(false, std::memory_order_relaxed);
+                        if (node->queued)
+                            node->queued->store(false, std::memory_order_release);
+                    }
+                    else
+                        next->push_back(node);
+                }
+
+                if (next->size() != current.size())
+                    publish(next.release());
+            }
+
+            // Caller holds writeMutex
+            void publish(const SlotList* next)
+            {
+                const SlotList* previous = slots.exchange(next);
+                retired.push_back({ previous, epoch.load() });
+                hasRetired.store(true);
+                reclaim();
+            }
+
+            // Caller holds writeMutex. The epoch may advance from E to E+1 once no reader of epoch E-1 is left; a list
+            // replaced during epoch E is unreachable once the epoch reaches E+2.
+            void reclaim()
+            {
+                for (int step = 0; step < 2; ++step)
+                {
+                    uint64_t current = epoch.load();
+                    if (readers[(current + 1) & 1].load() != 0)
+                        break;
+                    epoch.store(current + 1);
+                }
+
+                uint64_t current = epoch.load();
+                std::erase_if(retired,
+                              [current](const RetiredList& list)
+                              {
+                                  if (list.epoch + 2 > current)
+                                      return false;
+                                  delete list.slots;
+                                  return true;
+                              });
+                hasRetired.store(!retired.empty());
+            }
+        };
+
+        std::shared_ptr<State> m_state;
+    };
+} // namespace meta
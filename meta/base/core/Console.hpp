@@ -1,7 +1,7 @@
 #pragma once
 
-#include <iostream>
 #include <magic_enum/magic_enum.hpp>
+#include <meta/base/core/ConsoleOutput.hpp>
 #include <meta/base/core/Format.hpp>
 #include <meta/base/core/Platform.hpp>
 #include <meta/base/core/String.hpp>
@@ -50,108 +50,146 @@ namespace meta
             }
         }
 
-        // --- No-arg version (avoids constructing empty meta::String) ---
-        template <typename Stream> META_INLINE void consoleWriteTo(Stream&)
+        // --- Every call formats into one buffer and stages it once, so a colored line is a single write ---
+        template <typename... Args> META_INLINE void consoleWriteTo(ConsoleStream stream, Args&&... args)
         {
+            if constexpr (sizeof...(Args) > 0)
+            {
+                meta::String<> out;
+                meta::formatTo(out, args...);
+                consoleWriteRaw(stream, out.view());
+            }
         }
 
-        template <typename Stream, typename... Args> META_INLINE void consoleWriteTo(Stream& os, Args&&... args)
-        {
-            meta::String<> out = meta::format(std::forward<Args>(args)...);
-            os << out.c_str();
-        }
-
-        template <typename Stream, typename... Args> META_INLINE void consoleWriteLine(Stream& os, Args&&... args)
+        // --- Pattern version; the buffer is sized at compile time so it stays on the stack ---
+        template <FixedString Pattern, bool Newline, typename... Args>
+        META_INLINE void consoleWritePattern(ConsoleStream stream, const Args&... args)
         {
-            consoleWriteTo(os, std::forward<Args>(args)...);
-            os << '\n';
+            meta::String<formatCapacity<Pattern, Args...> + 1> out;
+            meta::formatTo<Pattern>(out, args...);
+            if constexpr (Newline)
+                out += '\n';
+            consoleWriteRaw(stream, out.view());
         }
 
-        template <typename Stream, typename... Args>
-        META_INLINE void consoleWriteColor(Stream& os, ConsoleColor color, Args&&... args)
+        template <typename... Args> META_INLINE void consoleWriteLine(ConsoleStream stream, Args&&... args)
         {
-            os << colorToAnsi(color);
-            consoleWriteTo(os, std::forward<Args>(args)...);
-            os << colorToAnsi(ConsoleColor::Default);
+            meta::String<> out;
+            meta::formatTo(out, args...);
+            out += '\n';
+            consoleWriteRaw(stream, out.view());
         }
 
-        template <typename Stream, typename... Args>
-        META_INLINE void consoleWriteLineColor(Stream& os, ConsoleColor color, Args&&... args)
+        template <typename... Args>
+        META_INLINE void consoleWriteColor(ConsoleStream stream, ConsoleColor color, bool newline, Args&&... args)
         {
-            os << colorToAnsi(color);
-            consoleWriteLine(os, std::forward<Args>(args)...);
-            os << colorToAnsi(ConsoleColor::Default);
+            // Not a terminal: plain text, no escape codes
+            bool colors = consoleColorsEnabled(stream);
+
+            meta::String<> out;
+            if (colors)
+                out += colorToAnsi(color);
+            meta::formatTo(out, args...);
+            if (colors)
+                out += colorToAnsi(ConsoleColor::Default);
+            if (newline)
+                out += '\n';
+            consoleWriteRaw(stream, out.view());
         }
     } // namespace internal
 
+    // Output goes through a per-thread line buffer and a shared lock-free ring (see ConsoleOutput.hpp);
+    // call flushConsole() to force out a partial line, e.g. before reading input.
+
     // --- Standard print ---
     template <typename... Args> META_INLINE void print(Args&&... args)
     {
-        internal::consoleWriteTo(std::cout, std::forward<Args>(args)...);
+        internal::consoleWriteTo(ConsoleStream::Out, std::forward<Args>(args)...);
     }
 
     template <typename... Args> META_INLINE void println(Args&&... args)
     {
-        internal::consoleWriteLine(std::cout, std::forward<Args>(args)...);
+        internal::consoleWriteLine(ConsoleStream::Out, std::forward<Args>(args)...);
+    }
+
+    // --- Pattern print, e.g. meta::println<"x={} y={}">(x, y) ---
+    template <FixedString Pattern, typename... Args> META_INLINE void print(const Args&... args)
+    {
+        internal::consoleWritePattern<Pattern, false>(ConsoleStream::Out, args...);
+    }
+
+    template <FixedString Pattern, typename... Args> META_INLINE void println(const Args&... args)
+    {
+        internal::consoleWritePattern<Pattern, true>(ConsoleStream::Out, args...);
     }
 
     template <typename... Args> META_INLINE void printColor(ConsoleColor color, Args&&... args)
     {
-        internal::consoleWriteColor(std::cout, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Out, color, false, std::forward<Args>(args)...);
     }
 
     template <typename... Args> META_INLINE void printlnColor(ConsoleColor color, Args&&... args)
     {
-        internal::consoleWriteLineColor(std::cout, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Out, color, true, std::forward<Args>(args)...);
     }
 
     // --- Error output ---
     template <typename... Args> META_INLINE void error(Args&&... args)
     {
-        internal::consoleWriteTo(std::cerr, std::forward<Args>(args)...);
+        internal::consoleWriteTo(ConsoleStream::Error, std::forward<Args>(args)...);
     }
 
     template <typename... Args> META_INLINE void errorln(Args&&... args)
     {
-        internal::consoleWriteLine(std::cerr, std::forward<Args>(args)...);
+        internal::consoleWriteLine(ConsoleStream::Error, std::forward<Args>(args)...);
+    }
+
+    template <FixedString Pattern, typename... Args> META_INLINE void error(const Args&... args)
+    {
+        internal::consoleWritePattern<Pattern, false>(ConsoleStream::Error, args...);
+    }
+
+    template <FixedString Pattern, typename... Args> META_INLINE void errorln(const Args&... args)
+    {
+        internal::consoleWritePattern<Pattern, true>(ConsoleStream::Error, args...);
     }
 
     template <typename... Args> META_INLINE void errorColor(ConsoleColor color, Args&&... args)
     {
-        internal::consoleWriteColor(std::cerr, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Error, color, false, std::forward<Args>(args)...);
     }
 
     template <typename... Args> META_INLINE void errorlnColor(ConsoleColor color, Args&&... args)
     {
-        internal::consoleWriteLineColor(std::cerr, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Error, color, true, std::forward<Args>(args)...);
     }
 
     // --- Debug output (only compiled in debug builds) ---
     template <typename... Args> META_INLINE void debug(Args&&... args)
     {
 #ifdef META_DEBUG
-        internal::consoleWriteTo(std::cout, std::forward<Args>(args)...);
+        internal::consoleWriteTo(ConsoleStream::Out, std::forward<Args>(args)...);
 #endif
     }
 
     template <typename... Args> META_INLINE void debugln(Args&&... args)
     {
 #ifdef META_DEBUG
-        internal::consoleWriteLine(std::cout, std::forward<Args>(args)...);
+        internal::consoleWriteLine(ConsoleStream::Out, std::forward<Args>(args)...);
 #endif
     }
 
     template <typename... Args> META_INLINE void debugColor(ConsoleColor color, Args&&... args)
     {
 #ifdef META_DEBUG
-        internal::consoleWriteColor(std::cout, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Out, color, false, std::forward<Args>(args)...);
 #endif
     }
 
     template <typename... Args> META_INLINE void debuglnColor(ConsoleColor color, Args&&... args)
     {
 #ifdef META_DEBUG
-        internal::consoleWriteLineColor(std::cout, color, std::forward<Args>(args)...);
+        internal::consoleWriteColor(ConsoleStream::Out, color, true, std::forward<Args>(args)...);
 #endif
     }
 } // namespace meta
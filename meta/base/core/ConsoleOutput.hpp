@@ -0,0 +1,353 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <meta/base/core/BoundedQueue.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/StringSearch.hpp>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+namespace meta
+{
+    enum class ConsoleStream
+    {
+        Out,
+        Error
+    };
+
+    namespace internal
+    {
+        // Writes everything to a file descriptor, retrying short writes and interrupted calls
+        META_INLINE void writeFd(int fd, const char* data, size_t size) noexcept
+        {
+            while (size > 0)
+            {
+#if defined(META_PLATFORM_WINDOWS)
+                int written = _write(fd, data, static_cast<unsigned int>(size));
+#else
+                ssize_t written = ::write(fd, data, size);
+#endif
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return;
+                }
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+        }
+
+        // Block of complete lines handed from a thread's staging buffer to the shared ring.
+        // Short blocks are stored inline so the common case does not allocate.
+        struct ConsoleChunk
+        {
+            static constexpr size_t InlineSize = 240;
+
+            size_t size = 0;
+            char inlineData[InlineSize];
+            std::unique_ptr<char[]> heap;
+
+            META_INLINE void assign(const char* data, size_t length)
+            {
+                if (length <= InlineSize)
+                {
+                    heap.reset();
+                    std::memcpy(inlineData, data, length);
+                }
+                else
+                {
+                    heap = std::make_unique_for_overwrite<char[]>(length);
+                    std::memcpy(heap.get(), data, length);
+                }
+                size = length;
+            }
+
+            META_NODISCARD META_INLINE const char* data() const noexcept
+            {
+                return heap ? heap.get() : inlineData;
+            }
+        };
+
+        // One output stream: a lock-free ring of chunks drained by whichever thread holds the drain flag
+        // (normally the background flusher). Each drain collects the queued chunks into one batch per write(2).
+        class ConsoleOutput
+        {
+        public:
+            static constexpr size_t RingCapacity = 1024;
+            static constexpr size_t BatchSize = 64 * 1024;
+
+            META_INLINE ConsoleOutput(int fd, bool writeThrough)
+                : m_fd(fd), m_writeThrough(writeThrough), m_queue(RingCapacity),
+                  m_batch(std::make_unique_for_overwrite<char[]>(BatchSize))
+            {
+#if META_HAS_ISATTY
+                m_colors = isatty(fd) != 0;
+#endif
+            }
+
+            META_NODISCARD META_INLINE bool colorsEnabled() const noexcept
+            {
+                return m_colors;
+            }
+
+            META_INLINE void push(const char* data, size_t size, bool writeThrough)
+            {
+                ConsoleChunk chunk;
+                chunk.assign(data, size);
+
+                // Ring full: help the writer instead of dropping output
+                while (!m_queue.tryPush(std::move(chunk)))
+                {
+                    drain();
+                    std::this_thread::yield();
+                }
+
+                if (m_writeThrough || writeThrough)
+                    flush();
+            }
+
+            // Writes whatever is queued; returns immediately if another thread is already draining
+            META_INLINE void drain() noexcept
+            {
+                if (m_draining.test_and_set(std::memory_order_acquire))
+                    return;
+                drainLocked();
+                m_draining.clear(std::memory_order_release);
+            }
+
+            // Like drain(), but waits for a concurrent drain so everything pushed before the call is written
+            META_INLINE void flush() noexcept
+            {
+                while (m_draining.test_and_set(std::memory_order_acquire))
+                    std::this_thread::yield();
+                drainLocked();
+                m_draining.clear(std::memory_order_release);
+            }
+
+        private:
+            int m_fd;
+            bool m_writeThrough;
+            bool m_colors = false;
+            BoundedQueue<ConsoleChunk> m_queue;
+            std::atomic_flag m_draining = ATOMIC_FLAG_INIT;
+            std::unique_ptr<char[]> m_batch; // only touched while m_draining is held
+            ConsoleChunk m_scratch;
+
+            META_INLINE void drainLocked() noexcept
+            {
+                size_t used = 0;
+                while (m_queue.tryPop(m_scratch))
+                {
+                    if (used + m_scratch.size > BatchSize)
+                    {
+                        writeFd(m_fd, m_batch.get(), used);
+                        used = 0;
+                    }
+
+                    if (m_scratch.size > BatchSize)
+                    {
+                        writeFd(m_fd, m_scratch.data(), m_scratch.size);
+                        continue;
+                    }
+
+                    std::memcpy(m_batch.get() + used, m_scratch.data(), m_scratch.size);
+                    used += m_scratch.size;
+                }
+
+                if (used > 0)
+                    writeFd(m_fd, m_batch.get(), used);
+                m_scratch.heap.reset();
+            }
+        };
+
+        // Owns both streams and the thread that drains stdout every flush interval. Never destroyed, so statics
+        // destroyed at exit (a global Logger, for instance) can still print and flush. At exit it writes out what is
+        // queued, including the main thread's staging buffers, and from then on writes every line immediately.
+        class ConsoleBackend
+        {
+        public:
+            static constexpr auto DefaultFlushInterval = std::chrono::milliseconds(5);
+
+            static ConsoleBackend& instance()
+            {
+                static ConsoleBackend* const backend = []
+                {
+                    auto* created = new ConsoleBackend();
+                    std::atexit([] { instance().finishAtExit(); });
+                    return created;
+                }();
+                return *backend;
+            }
+
+            META_NODISCARD META_INLINE ConsoleOutput& output(ConsoleStream stream) noexcept
+            {
+                return stream == ConsoleStream::Out ? m_out : m_err;
+            }
+
+            // Zero writes every completed line immediately
+            META_INLINE void setFlushInterval(std::chrono::milliseconds interval) noexcept
+            {
+                m_intervalMs.store(interval.count(), std::memory_order_relaxed);
+                m_wake.notify_one();
+            }
+
+            META_NODISCARD META_INLINE bool writeThrough() const noexcept
+            {
+                return m_intervalMs.load(std::memory_order_relaxed) <= 0;
+            }
+
+            META_INLINE void flush() noexcept
+            {
+                m_out.flush();
+                m_err.flush();
+            }
+
+        private:
+            ConsoleOutput m_out{ 1, false };
+            ConsoleOutput m_err{ 2, true }; // stderr stays unbuffered: each line is written as soon as it completes
+            std::atomic<int64_t> m_intervalMs{ DefaultFlushInterval.count() };
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+
+            ConsoleBackend()
+            {
+                std::thread([this] { run(); }).detach();
+            }
+
+            // Output from destructors that run after this is written through, as the flusher may be gone by then
+            void finishAtExit() noexcept
+            {
+                m_intervalMs.store(0, std::memory_order_relaxed);
+                flush();
+            }
+
+            void run()
+            {
+                std::unique_lock lock(m_mutex);
+                for (;;)
+                {
+                    int64_t interval = m_intervalMs.load(std::memory_order_relaxed);
+                    m_wake.wait_for(lock, std::chrono::milliseconds(interval > 0 ? interval : 100));
+
+                    lock.unlock();
+                    m_out.drain();
+                    lock.lock();
+                }
+            }
+        };
+
+        // Per-thread buffer that collects output until a line is complete, so lines from different threads never
+        // interleave. A trailing partial line (print without newline) waits for its newline, flushConsole() or
+        // thread exit.
+        class ConsoleStaging
+        {
+        public:
+            static constexpr size_t Capacity = 4096;
+
+            META_INLINE explicit ConsoleStaging(ConsoleStream stream) noexcept : m_stream(stream)
+            {
+            }
+
+            ConsoleStaging(const ConsoleStaging&) = delete;
+            ConsoleStaging& operator=(const ConsoleStaging&) = delete;
+
+            ~ConsoleStaging()
+            {
+                flush();
+            }
+
+            META_INLINE void write(std::string_view text)
+            {
+                if (text.empty())
+                    return;
+
+                ConsoleBackend& backend = ConsoleBackend::instance();
+                if (m_size + text.size() > Capacity)
+                {
+                    pushStaged(backend, m_size);
+                    if (text.size() > Capacity)
+                    {
+                        backend.output(m_stream).push(text.data(), text.size(), backend.writeThrough());
+                        return;
+                    }
+                }
+
+                std::memcpy(m_data + m_size, text.data(), text.size());
+                m_size += text.size();
+
+                size_t lastNewline = search::rfindChar(m_data, m_size, '\n');
+                if (lastNewline != search::npos)
+                    pushStaged(backend, lastNewline + 1);
+            }
+
+            // Hands over the partial line too and waits until everything is written
+            META_INLINE void flush()
+            {
+                ConsoleBackend& backend = ConsoleBackend::instance();
+                pushStaged(backend, m_size);
+                backend.output(m_stream).flush();
+            }
+
+        private:
+            ConsoleStream m_stream;
+            size_t m_size = 0;
+            char m_data[Capacity];
+
+            META_INLINE void pushStaged(ConsoleBackend& backend, size_t count)
+            {
+                if (count == 0)
+                    return;
+
+                backend.output(m_stream).push(m_data, count, backend.writeThrough());
+                std::memmove(m_data, m_data + count, m_size - count);
+                m_size -= count;
+            }
+        };
+
+        META_INLINE ConsoleStaging& consoleStaging(ConsoleStream stream)
+        {
+            thread_local ConsoleStaging out(ConsoleStream::Out);
+            thread_local ConsoleStaging err(ConsoleStream::Error);
+            return stream == ConsoleStream::Out ? out : err;
+        }
+
+        // stderr is tied to stdout, as std::cerr is to std::cout: the thread's pending stdout output (partial line
+        // included) and everything already queued for stdout is written first, so the two keep their order
+        META_INLINE void consoleWriteRaw(ConsoleStream stream, std::string_view text)
+        {
+            if (stream == ConsoleStream::Error)
+                consoleStaging(ConsoleStream::Out).flush();
+            consoleStaging(stream).write(text);
+        }
+    } // namespace internal
+
+    // True when the stream is a terminal; colored output skips ANSI codes otherwise
+    META_NODISCARD META_INLINE bool consoleColorsEnabled(ConsoleStream stream = ConsoleStream::Out)
+    {
+        return internal::ConsoleBackend::instance().output(stream).colorsEnabled();
+    }
+
+    // How often buffered stdout lines are written out; zero writes each completed line immediately
+    META_INLINE void setConsoleFlushInterval(std::chrono::milliseconds interval)
+    {
+        internal::ConsoleBackend::instance().setFlushInterval(interval);
+    }
+
+    // Writes the calling thread's pending output (including a partial line) and everything already queued
+    META_INLINE void flushConsole()
+    {
+        internal::consoleStaging(ConsoleStream::Out).flush();
+        internal::consoleStaging(ConsoleStream::Error).flush();
+    }
+} // namespace meta
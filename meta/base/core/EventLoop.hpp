@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <meta/base/core/BoundedQueue.hpp>
+#include <meta/base/core/InplaceFunction.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bytes of captures a posted task keeps inline; larger callables are moved to the heap
+#ifndef META_EVENT_LOOP_TASK_CAPACITY
+#define META_EVENT_LOOP_TASK_CAPACITY 64
+#endif
+
+namespace meta
+{
+    // Tasks posted from any thread and run by the thread that owns the loop, e.g. the GUI thread once per frame.
+    // post() goes into a lock-free ring; only when the ring is full does it fall back to a locked overflow list, so
+    // producers never block and nothing is lost. Tasks from one thread run in the order they were posted.
+    // Tasks are stored inline, so posting a callable of up to TaskCapacity bytes does not allocate.
+    class EventLoop
+    {
+    public:
+        static constexpr size_t TaskCapacity = META_EVENT_LOOP_TASK_CAPACITY;
+        using Task = InplaceFunction<void(), TaskCapacity>;
+
+        static constexpr size_t DefaultCapacity = 4096;
+
+        META_INLINE explicit EventLoop(size_t capacity = DefaultCapacity) : m_ring(capacity)
+        {
+        }
+
+        EventLoop(const EventLoop&) = delete;
+        EventLoop& operator=(const EventLoop&) = delete;
+
+        // Safe to call from any thread
+        template <typename Func>
+            requires std::invocable<std::decay_t<Func>&>
+        void post(Func&& func)
+        {
+            push(Task::fitOrBox(std::forward<Func>(func)));
+        }
+
+        // Runs the tasks queued so far and returns how many ran. Call from the owning thread only; tasks posted
+        // while draining (including by the tasks themselves) wait for the next call.
+        size_t drain()
+        {
+            size_t limit = m_ring.capacity();
+            size_t count = 0;
+
+            Task task;
+            while (count < limit && m_ring.tryPop(task))
+            {
+                task();
+                ++count;
+            }
+
+            if (m_overflowing.load(std::memory_order_acquire))
+            {
+                // Overflowed tasks come after everything still in the ring, so finish the ring first, waiting out
+                // producers that have claimed a cell but not filled it yet
+                while (!m_ring.empty())
+                {
+                    if (m_ring.tryPop(task))
+                    {
+                        task();
+                        ++count;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                {
+                    std::lock_guard lock(m_overflowMutex);
+                    std::swap(m_draining, m_overflow);
+                    m_overflowing.store(false, std::memory_order_release);
+                }
+                for (auto& overflowTask : m_draining)
+                    overflowTask();
+                count += m_draining.size();
+                m_draining.clear();
+            }
+            return count;
+        }
+
+        META_NODISCARD bool empty() const noexcept
+        {
+            return m_ring.empty() && !m_overflowing.load(std::memory_order_acquire);
+        }
+
+    private:
+        void push(Task task)
+        {
+            if (!m_overflowing.load(std::memory_order_acquire) && m_ring.tryPush(std::move(task)))
+                return;
+
+            // Once anything overflowed, later tasks queue behind it until drain() catches up, keeping order
+            std::lock_guard lock(m_overflowMutex);
+            m_overflow.push_back(std::move(task));
+            m_overflowing.store(true, std::memory_order_release);
+        }
+
+        BoundedQueue<Task> m_ring;
+        std::atomic<bool> m_overflowing{ false };
+        std::mutex m_overflowMutex;
+        std::vector<Task> m_overflow;
+        std::vector<Task> m_draining; // owner thread only
+    };
+} // namespace meta
@@ -1,35 +1,287 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <limits>
 #include <meta/base/core/String.hpp>
 #include <sstream>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 
 namespace meta
 {
-    // --- Convert any value to meta::String<> ---
-    template <typename T> inline meta::String<> to_meta_string(const T& value)
+    // --- Per-type formatters, selected at compile time ---
+    // Each formatter appends the text of a value straight into the output string, so nothing is allocated as long as
+    // the result fits in the string's inline storage. Specialize Formatter<T> to add support for a new type.
+    template <typename T> struct Formatter
     {
-        if constexpr (std::is_same_v<T, meta::String<>>)
+        // Fallback for any other streamable type
+        template <size_t N>
+            requires requires(std::ostream& os, const T& value) { os << value; }
+        static META_INLINE void format(String<N>& out, const T& value)
         {
-            return value;
+            std::ostringstream oss;
+            oss << value;
+            out += std::string_view(oss.str());
         }
-        else if constexpr (std::is_convertible_v<T, std::string>)
+    };
+
+    template <typename T>
+        requires std::is_convertible_v<const T&, std::string_view>
+    struct Formatter<T>
+    {
+        template <size_t N> static META_INLINE void format(String<N>& out, const T& value)
         {
-            return meta::String<>(value);
+            out += std::string_view(value);
         }
-        else
+    };
+
+    template <> struct Formatter<bool>
+    {
+        static constexpr size_t maxSize = 1;
+
+        // Matches iostream's default (noboolalpha) so values written to INI files still parse back
+        template <size_t N> static META_INLINE void format(String<N>& out, bool value)
+        {
+            out += value ? '1' : '0';
+        }
+    };
+
+    template <typename T>
+    concept CharacterType =
+        std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+    // Like iostreams, int8_t and uint8_t are written as characters; cast to int to get the number
+    template <CharacterType T> struct Formatter<T>
+    {
+        static constexpr size_t maxSize = 1;
+
+        template <size_t N> static META_INLINE void format(String<N>& out, T value)
+        {
+            out += static_cast<char>(value);
+        }
+    };
+
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !CharacterType<T>)
+    struct Formatter<T>
+    {
+        // Digits plus sign
+        static constexpr size_t maxSize = std::numeric_limits<T>::digits10 + 2;
+
+        template <size_t N> static META_INLINE void format(String<N>& out, T value)
+        {
+            char buffer[24];
+            auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out += std::string_view(buffer, static_cast<size_t>(end - buffer));
+        }
+    };
+
+    template <std::floating_point T> struct Formatter<T>
+    {
+        // Digits plus sign, decimal point and exponent
+        static constexpr size_t maxSize = std::numeric_limits<T>::max_digits10 + 8;
+
+        // Shortest representation that round-trips back to the same value
+        template <size_t N> static META_INLINE void format(String<N>& out, T value)
+        {
+            char buffer[64];
+            auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out += std::string_view(buffer, static_cast<size_t>(end - buffer));
+        }
+    };
+
+    template <typename T>
+    concept Formattable = requires(String<>& out, const T& value) { Formatter<T>::format(out, value); };
+
+    // --- Format pattern usable as a template argument, e.g. meta::format<"x={} y={}">(x, y) ---
+    template <size_t L> struct FixedString
+    {
+        char data[L]{};
+
+        consteval FixedString(const char (&str)[L])
+        {
+            for (size_t i = 0; i < L; ++i)
+                data[i] = str[i];
+        }
+
+        META_NODISCARD constexpr size_t size() const noexcept
+        {
+            return L - 1;
+        }
+    };
+
+    namespace internal
+    {
+        // A pattern is split into literal runs and "{}" argument slots
+        struct FormatSegment
+        {
+            size_t offset = 0;
+            size_t length = 0;
+            bool isArg = false;
+            size_t argIndex = 0;
+        };
+
+        // Not constexpr on purpose: reaching it while parsing a pattern is a compile error
+        inline void invalidFormatPattern(const char*)
         {
-            std::ostringstream oss;
-            oss << value;
-            return meta::String<>(oss.str());
         }
+
+        // Walks the pattern and reports every segment to visit; "{{" and "}}" are escaped braces
+        template <typename Visitor> consteval void parsePattern(std::string_view pattern, Visitor&& visit)
+        {
+            size_t literalStart = 0;
+            size_t argIndex = 0;
+            size_t i = 0;
+
+            auto flushLiteral = [&](size_t end)
+            {
+                if (end > literalStart)
+                    visit(FormatSegment{ literalStart, end - literalStart, false, 0 });
+            };
+
+            while (i < pattern.size())
+            {
+                char c = pattern[i];
+                if (c == '{' && i + 1 < pattern.size() && pattern[i + 1] == '{')
+                {
+                    flushLiteral(i + 1);
+                    literalStart = i += 2;
+                }
+                else if (c == '}' && i + 1 < pattern.size() && pattern[i + 1] == '}')
+                {
+                    flushLiteral(i + 1);
+                    literalStart = i += 2;
+                }
+                else if (c == '{')
+                {
+                    if (i + 1 >= pattern.size() || pattern[i + 1] != '}')
+                        invalidFormatPattern("'{' must be followed by '}' or escaped as '{{'");
+                    flushLiteral(i);
+                    visit(FormatSegment{ i, 2, true, argIndex++ });
+                    literalStart = i += 2;
+                }
+                else if (c == '}')
+                {
+                    invalidFormatPattern("unmatched '}', escape it as '}}'");
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            flushLiteral(pattern.size());
+        }
+
+        template <FixedString Pattern> consteval size_t segmentCount()
+        {
+            size_t count = 0;
+            parsePattern(std::string_view(Pattern.data, Pattern.size()), [&](const FormatSegment&) { ++count; });
+            return count;
+        }
+
+        template <FixedString Pattern> consteval auto segments()
+        {
+            std::array<FormatSegment, segmentCount<Pattern>()> result{};
+            size_t index = 0;
+            parsePattern(std::string_view(Pattern.data, Pattern.size()),
+                         [&](const FormatSegment& segment) { result[index++] = segment; });
+            return result;
+        }
+
+        template <FixedString Pattern> consteval size_t argCount()
+        {
+            size_t count = 0;
+            for (const auto& segment : segments<Pattern>())
+                count += segment.isArg ? 1 : 0;
+            return count;
+        }
+
+        template <FixedString Pattern> consteval size_t literalSize()
+        {
+            size_t size = 0;
+            for (const auto& segment : segments<Pattern>())
+                size += segment.isArg ? 0 : segment.length;
+            return size;
+        }
+
+        // Upper bound of a formatted argument; types without one (strings, paths, ...) get a fixed guess
+        template <typename T> consteval size_t formatSizeHint()
+        {
+            if constexpr (std::is_array_v<T>)
+                return std::extent_v<T> - 1;
+            else if constexpr (requires { Formatter<T>::maxSize; })
+                return Formatter<T>::maxSize;
+            else
+                return 32;
+        }
+    } // namespace internal
+
+    // Inline capacity that holds the formatted pattern without spilling to the heap
+    template <FixedString Pattern, typename... Args>
+    inline constexpr size_t formatCapacity =
+        (internal::literalSize<Pattern>() + ... + internal::formatSizeHint<std::remove_cvref_t<Args>>());
+
+    // --- Append all arguments to an existing string ---
+    template <size_t N, typename... Args> META_INLINE void formatTo(String<N>& out, const Args&... args)
+    {
+        (Formatter<std::remove_cvref_t<Args>>::format(out, args), ...);
     }
 
-    // --- Variadic format function ---
-    template <typename... Args> inline meta::String<> format(Args&&... args)
+    // --- Append a pattern with its "{}" slots filled in, checked at compile time ---
+    template <FixedString Pattern, size_t N, typename... Args>
+    META_INLINE void formatTo(String<N>& out, const Args&... args)
+    {
+        static_assert(internal::argCount<Pattern>() == sizeof...(Args),
+                      "meta::format: number of arguments does not match the number of {} in the pattern");
+        static_assert((Formattable<std::remove_cvref_t<Args>> && ...), "meta::format: argument type has no Formatter");
+
+        static constexpr auto segments = internal::segments<Pattern>();
+        auto argTuple = std::forward_as_tuple(args...);
+
+        auto writeSegment = [&]<size_t I>()
+        {
+            constexpr internal::FormatSegment segment = segments[I];
+            if constexpr (segment.isArg)
+            {
+                using Arg = std::remove_cvref_t<std::tuple_element_t<segment.argIndex, std::tuple<Args...>>>;
+                Formatter<Arg>::format(out, std::get<segment.argIndex>(argTuple));
+            }
+            else
+            {
+                out += std::string_view(Pattern.data + segment.offset, segment.length);
+            }
+        };
+
+        [&]<size_t... I>(std::index_sequence<I...>)
+        { (writeSegment.template operator()<I>(), ...); }(std::make_index_sequence<segments.size()>{});
+    }
+
+    // --- Convert any value to meta::String<> ---
+    template <typename T> inline meta::String<> to_meta_string(const T& value)
     {
         meta::String<> result;
-        ((result += to_meta_string(std::forward<Args>(args))), ...); // fold expression
+        formatTo(result, value);
+        return result;
+    }
+
+    // --- Variadic format function ---
+    // N picks the inline capacity of the result, e.g. meta::format<256>(...) for longer lines.
+    template <size_t N = 128, typename... Args> inline meta::String<N> format(Args&&... args)
+    {
+        meta::String<N> result;
+        formatTo(result, args...);
+        return result;
+    }
+
+    // Result is sized from the pattern and argument types, so bounded arguments never spill to the heap
+    template <FixedString Pattern, typename... Args>
+    inline meta::String<formatCapacity<Pattern, Args...>> format(Args&&... args)
+    {
+        meta::String<formatCapacity<Pattern, Args...>> result;
+        formatTo<Pattern>(result, args...);
         return result;
     }
 
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <meta/base/core/Platform.hpp>
+#include <string_view>
+
+#if defined(META_COMPILER_MSVC) && defined(META_ARCH_X64)
+#include <intrin.h>
+#endif
+
+namespace meta
+{
+    namespace internal
+    {
+        // 64x64 -> 128 bit multiply, returned as (low, high) in place
+        META_FORCE_INLINE void wyMultiply(uint64_t& a, uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t r = static_cast<__uint128_t>(a) * b;
+            a = static_cast<uint64_t>(r);
+            b = static_cast<uint64_t>(r >> 64);
+#elif defined(META_COMPILER_MSVC) && defined(META_ARCH_X64)
+            a = _umul128(a, b, &b);
+#else
+            uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+            uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+            uint64_t carry = t < rl;
+            uint64_t lo = t + (rm1 << 32);
+            carry += lo < t;
+            uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+            a = lo;
+            b = hi;
+#endif
+        }
+
+        META_FORCE_INLINE uint64_t wyMix(uint64_t a, uint64_t b) noexcept
+        {
+            wyMultiply(a, b);
+            return a ^ b;
+        }
+
+        META_FORCE_INLINE uint64_t wyRead8(const uint8_t* p) noexcept
+        {
+            uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        META_FORCE_INLINE uint64_t wyRead4(const uint8_t* p) noexcept
+        {
+            uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        META_FORCE_INLINE uint64_t wyRead3(const uint8_t* p, size_t k) noexcept
+        {
+            return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+        }
+
+        inline constexpr uint64_t WySecret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull,
+                                                  0x4d5a2da51de1aa47ull };
+    } // namespace internal
+
+    // wyhash (final version 4): processes 48 bytes per round with three independent multiply lanes and reads short
+    // keys with at most two overlapping loads, so small keys such as INI names cost a handful of instructions.
+    META_NODISCARD META_INLINE uint64_t wyhash(const void* key, size_t len, uint64_t seed = 0) noexcept
+    {
+        using namespace internal;
+
+        const auto* p = static_cast<const uint8_t*>(key);
+        seed ^= wyMix(seed ^ WySecret[0], WySecret[1]);
+        uint64_t a, b;
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                a = (wyRead4(p) << 32) | wyRead4(p + ((len >> 3) << 2));
+                b = (wyRead4(p + len - 4) << 32) | wyRead4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0)
+            {
+                a = wyRead3(p, len);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            size_t i = len;
+            if (i >= 48)
+            {
+                uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = wyMix(wyRead8(p) ^ WySecret[1], wyRead8(p + 8) ^ seed);
+                    see1 = wyMix(wyRead8(p + 16) ^ WySecret[2], wyRead8(p + 24) ^ see1);
+                    see2 = wyMix(wyRead8(p + 32) ^ WySecret[3], wyRead8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i >= 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = wyMix(wyRead8(p) ^ WySecret[1], wyRead8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = wyRead8(p + i - 16);
+            b = wyRead8(p + i - 8);
+        }
+
+        a ^= WySecret[1];
+        b ^= seed;
+        wyMultiply(a, b);
+        return wyMix(a ^ WySecret[0] ^ len, b ^ WySecret[1]);
+    }
+
+    // --- Hash policies ---
+    // A policy is any type with a static hash(std::string_view). Pass one to StringHash to pick the function per
+    // container, e.g. std::unordered_map<String<>, int, meta::StringHash<meta::StdHashPolicy>>.
+    struct WyHashPolicy
+    {
+        static META_INLINE size_t hash(std::string_view sv) noexcept
+        {
+            return static_cast<size_t>(wyhash(sv.data(), sv.size()));
+        }
+    };
+
+    struct StdHashPolicy
+    {
+        static META_INLINE size_t hash(std::string_view sv) noexcept
+        {
+            return std::hash<std::string_view>{}(sv);
+        }
+    };
+
+    using DefaultHashPolicy = WyHashPolicy;
+
+    // Hash shared by String, Path, Atom and any container that mixes them, so equal text always hashes the same
+    META_NODISCARD META_INLINE size_t hashString(std::string_view sv) noexcept
+    {
+        return DefaultHashPolicy::hash(sv);
+    }
+
+    // Transparent hasher for any string-like key (String<N>, Path, StringView, Atom, literals, ...)
+    template <typename Policy = DefaultHashPolicy> struct StringHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view sv) const noexcept
+        {
+            return Policy::hash(sv);
+        }
+    };
+} // namespace meta
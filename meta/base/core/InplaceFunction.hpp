@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <meta/base/core/Platform.hpp>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace meta
+{
+    template <typename Signature, size_t Capacity = 48> class InplaceFunction;
+
+    // Move-only callable kept inside the object, so storing one never allocates. The constructor rejects a callable
+    // that does not fit in Capacity bytes (or needs more than std::max_align_t alignment) at compile time; fitOrBox()
+    // moves such a callable to the heap instead.
+    template <typename R, typename... Args, size_t Capacity> class InplaceFunction<R(Args...), Capacity>
+    {
+    public:
+        // Whether the constructor accepts a callable of type F
+        template <typename F>
+        static constexpr bool fitsInline = sizeof(std::decay_t<F>) <= Capacity &&
+                                           alignof(std::decay_t<F>) <= alignof(std::max_align_t) &&
+                                           std::is_nothrow_move_constructible_v<std::decay_t<F>>;
+
+        // Stores the callable inline when it fits, otherwise keeps it in a heap allocation and stores only the pointer
+        template <typename F>
+            requires std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+        META_INLINE static InplaceFunction fitOrBox(F&& function)
+        {
+            using Stored = std::decay_t<F>;
+            if constexpr (std::is_same_v<Stored, InplaceFunction> || fitsInline<Stored>)
+            {
+                return InplaceFunction(std::forward<F>(function));
+            }
+            else
+            {
+                return InplaceFunction([boxed = std::make_unique<Stored>(std::forward<F>(function))](Args... args) -> R
+                                       { return std::invoke(*boxed, std::forward<Args>(args)...); });
+            }
+        }
+
+        META_INLINE InplaceFunction() noexcept = default;
+
+        META_INLINE InplaceFunction(std::nullptr_t) noexcept
+        {
+        }
+
+        template <typename F>
+            requires(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> &&
+                     std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+        META_INLINE InplaceFunction(F&& function)
+        {
+            using Stored = std::decay_t<F>;
+            static_assert(sizeof(Stored) <= Capacity, "callable does not fit in the InplaceFunction capacity");
+            static_assert(alignof(Stored) <= alignof(std::max_align_t), "over-aligned callable");
+            static_assert(std::is_nothrow_move_constructible_v<Stored>, "callable must be nothrow movable");
+
+            if constexpr (std::is_pointer_v<Stored> || std::is_member_pointer_v<Stored>)
+            {
+                if (function == nullptr)
+                    return;
+            }
+
+            ::new (static_cast<void*>(m_storage)) Stored(std::forward<F>(function));
+            m_ops = &OpsFor<Stored>::ops;
+        }
+
+        META_INLINE InplaceFunction(InplaceFunction&& other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        META_INLINE InplaceFunction& operator=(InplaceFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        META_INLINE InplaceFunction& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        InplaceFunction(const InplaceFunction&) = delete;
+        InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+        META_INLINE ~InplaceFunction()
+        {
+            reset();
+        }
+
+        META_NODISCARD META_INLINE explicit operator bool() const noexcept
+        {
+            return m_ops != nullptr;
+        }
+
+        // Calling an empty InplaceFunction throws std::bad_function_call, like std::function
+        META_INLINE R operator()(Args... args) const
+        {
+            if (!m_ops)
+                throw std::bad_function_call();
+            return m_ops->invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+        }
+
+    private:
+        struct Ops
+        {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*relocate)(void* from, void* to) noexcept; // move-construct into to, destroy from
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename T> struct OpsFor
+        {
+            static R invoke(void* storage, Args&&... args)
+            {
+                return std::invoke(*static_cast<T*>(storage), std::forward<Args>(args)...);
+            }
+
+            static void relocate(void* from, void* to) noexcept
+            {
+                T* source = static_cast<T*>(from);
+                ::new (to) T(std::move(*source));
+                source->~T();
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                static_cast<T*>(storage)->~T();
+            }
+
+            static constexpr Ops ops{ &invoke, &relocate, &destroy };
+        };
+
+        alignas(std::max_align_t) std::byte m_storage[Capacity];
+        const Ops* m_ops = nullptr;
+
+        META_INLINE void reset() noexcept
+        {
+            if (m_ops)
+            {
+                m_ops->destroy(m_storage);
+                m_ops = nullptr;
+            }
+        }
+
+        META_INLINE void moveFrom(InplaceFunction& other) noexcept
+        {
+            if (other.m_ops)
+            {
+                other.m_ops->relocate(other.m_storage, m_storage);
+                m_ops = std::exchange(other.m_ops, nullptr);
+            }
+        }
+    };
+} // namespace meta
@@ -20,6 +20,14 @@
 #define META_COMPILER_UNKNOWN 1
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define META_ARCH_X64 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define META_ARCH_ARM64 1
+#else
+#define META_ARCH_UNKNOWN 1
+#endif
+
 #if __cplusplus >= 202311L
 #define META_HAS_CPP23 1
 #elif __cplusplus >= 202002L
@@ -38,6 +46,14 @@
 #define META_FORCE_INLINE inline
 #endif
 
+#if defined(META_COMPILER_MSVC)
+#define META_NOINLINE __declspec(noinline)
+#elif defined(META_COMPILER_GCC) || defined(META_COMPILER_CLANG)
+#define META_NOINLINE __attribute__((noinline))
+#else
+#define META_NOINLINE
+#endif
+
 #define META_INLINE inline
 
 #if defined(META_HAS_CPP17)
@@ -67,6 +83,13 @@
 #define META_ALIGN(x)
 #endif
 
+// Marks a function as compiled for AVX2 so it can be selected at runtime
+#if defined(META_COMPILER_GCC) || defined(META_COMPILER_CLANG)
+#define META_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define META_TARGET_AVX2
+#endif
+
 #if __cpp_no_unique_address >= 201907L
 #define META_NO_UNIQUE_ADDRESS [[no_unique_address]]
 #else
@@ -0,0 +1,646 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <meta/base/core/Atom.hpp>
+#include <meta/base/core/Clock.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/ThreadInfo.hpp>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Profiled scopes (META_PROFILE_SCOPE) are compiled in only with -DMETA_PROFILER=1
+#ifndef META_PROFILER
+#define META_PROFILER 0
+#endif
+
+// Completed scopes, counters and instants kept while a trace is running (Profiler::startTrace)
+#ifndef META_PROFILER_TRACE_SIZE
+#define META_PROFILER_TRACE_SIZE (1 << 18)
+#endif
+
+// Events each thread can buffer between two Profiler::collect() calls; must be a power of two
+#ifndef META_PROFILER_BUFFER_SIZE
+#define META_PROFILER_BUFFER_SIZE 16384
+#endif
+
+namespace meta
+{
+    // One profiled scope, counter or instant in the source, declared as a static by the META_PROFILE_* macros
+    struct ProfileSite
+    {
+        std::string_view name;
+        std::string_view file;
+        int line = 0;
+    };
+
+    namespace internal
+    {
+        using ProfilerClock = TscClock;
+
+        META_FORCE_INLINE int64_t profileNow() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(ProfilerClock::now().time_since_epoch())
+                .count();
+        }
+
+        struct ProfileEvent
+        {
+            enum class Kind : uint32_t
+            {
+                Begin,
+                End,
+                Counter, // value is the counter's new value
+                Instant,
+            };
+
+            const ProfileSite* site;
+            int64_t time; // nanoseconds
+            double value;
+            Kind kind;
+        };
+
+        // Ring written by its own thread and drained by Profiler::collect(). When it is full new events are dropped,
+        // scopes whole: an event is only stored if the End of every open scope still fits, so the collector never
+        // sees an unmatched pair.
+        class ThreadProfileBuffer
+        {
+        public:
+            static constexpr uint64_t Capacity = META_PROFILER_BUFFER_SIZE;
+            static_assert(std::has_single_bit(Capacity), "META_PROFILER_BUFFER_SIZE must be a power of two");
+
+            ThreadProfileBuffer(uint32_t threadId, Atom threadName)
+                : m_threadId(threadId), m_threadName(threadName), m_events(new ProfileEvent[Capacity])
+            {
+            }
+
+            // Owner thread only; returns false if the scope was dropped
+            META_FORCE_INLINE bool begin(const ProfileSite* site, int64_t time) noexcept
+            {
+                if (!fits(2))
+                    return false;
+                ++m_openScopes;
+                push({ site, time, 0.0, ProfileEvent::Kind::Begin });
+                return true;
+            }
+
+            // Owner thread only, for a scope whose begin() returned true; always fits
+            META_FORCE_INLINE void end(const ProfileSite* site, int64_t time) noexcept
+            {
+                --m_openScopes;
+                push({ site, time, 0.0, ProfileEvent::Kind::End });
+            }
+
+            // Owner thread only; a counter or instant event
+            META_FORCE_INLINE void mark(const ProfileSite* site, int64_t time, ProfileEvent::Kind kind,
+                                        double value) noexcept
+            {
+                if (fits(1))
+                    push({ site, time, value, kind });
+            }
+
+            // Collector only
+            template <typename Func> void drain(Func&& func)
+            {
+                uint64_t tail = m_tail.load(std::memory_order_relaxed);
+                uint64_t head = m_published.load(std::memory_order_acquire);
+                for (; tail != head; ++tail)
+                    func(m_events[tail & (Capacity - 1)]);
+                m_tail.store(tail, std::memory_order_release);
+            }
+
+            META_NODISCARD uint32_t threadId() const noexcept
+            {
+                return m_threadId;
+            }
+
+            // Name of the thread when it recorded its first event
+            META_NODISCARD Atom threadName() const noexcept
+            {
+                return m_threadName;
+            }
+
+            META_NODISCARD uint64_t takeDropped() noexcept
+            {
+                return m_dropped.exchange(0, std::memory_order_relaxed);
+            }
+
+            // Set when the owning thread exits
+            std::atomic<bool> finished{ false };
+
+        private:
+            // Owner thread
+            alignas(64) uint64_t m_head = 0;
+            uint64_t m_cachedTail = 0;
+            uint64_t m_openScopes = 0;
+            std::atomic<uint64_t> m_published{ 0 };
+            std::atomic<uint64_t> m_dropped{ 0 };
+
+            // Collector
+            alignas(64) std::atomic<uint64_t> m_tail{ 0 };
+
+            uint32_t m_threadId;
+            Atom m_threadName;
+            std::unique_ptr<ProfileEvent[]> m_events;
+
+            // Room for count more events besides the Ends of the open scopes
+            META_FORCE_INLINE bool fits(uint64_t count) noexcept
+            {
+                if (m_head - m_cachedTail + m_openScopes + count > Capacity)
+                {
+                    m_cachedTail = m_tail.load(std::memory_order_acquire);
+                    if (m_head - m_cachedTail + m_openScopes + count > Capacity)
+                    {
+                        m_dropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            META_FORCE_INLINE void push(const ProfileEvent& event) noexcept
+            {
+                m_events[m_head & (Capacity - 1)] = event;
+                m_published.store(++m_head, std::memory_order_release);
+            }
+        };
+
+        // Buffers of all threads that have recorded a scope. A buffer outlives its thread until it has been drained.
+        struct ProfilerRegistry
+        {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<ThreadProfileBuffer>> buffers;
+
+            static ProfilerRegistry& instance()
+            {
+                static ProfilerRegistry registry;
+                return registry;
+            }
+        };
+
+        struct ThreadProfileHandle
+        {
+            ThreadProfileHandle()
+                : buffer(std::make_shared<ThreadProfileBuffer>(currentThreadId(), currentThreadName()))
+            {
+                auto& registry = ProfilerRegistry::instance();
+                std::lock_guard lock(registry.mutex);
+                registry.buffers.push_back(buffer);
+            }
+
+            ~ThreadProfileHandle()
+            {
+                buffer->finished.store(true, std::memory_order_release);
+            }
+
+            std::shared_ptr<ThreadProfileBuffer> buffer;
+        };
+
+        // Registered on the thread's first profiled event
+        META_FORCE_INLINE ThreadProfileBuffer& threadProfileBuffer()
+        {
+            thread_local ThreadProfileHandle handle;
+            return *handle.buffer;
+        }
+
+        META_FORCE_INLINE void profileMark(const ProfileSite& site, ProfileEvent::Kind kind, double value) noexcept
+        {
+            threadProfileBuffer().mark(&site, profileNow(), kind, value);
+        }
+
+        // Writes text as the contents of a JSON string
+        META_INLINE void writeJsonString(std::ostream& out, std::string_view text)
+        {
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << ' ';
+                else
+                    out << c;
+            }
+        }
+    } // namespace internal
+
+    // Durations of one call-tree node, in nanoseconds. Percentiles come from a log-linear histogram and are within
+    // about 3% of the exact value.
+    class ProfileStats
+    {
+    public:
+        META_INLINE void add(int64_t duration, int64_t self) noexcept
+        {
+            auto value = static_cast<uint64_t>(std::max<int64_t>(duration, 0));
+            ++m_count;
+            m_total += value;
+            m_self += static_cast<uint64_t>(std::max<int64_t>(self, 0));
+            m_min = std::min(m_min, value);
+            m_max = std::max(m_max, value);
+            ++m_histogram[bucketOf(value)];
+        }
+
+        META_NODISCARD uint64_t count() const noexcept
+        {
+            return m_count;
+        }
+
+        // Time inside the scope, including children
+        META_NODISCARD uint64_t total() const noexcept
+        {
+            return m_total;
+        }
+
+        // Time inside the scope minus its profiled children
+        META_NODISCARD uint64_t self() const noexcept
+        {
+            return m_self;
+        }
+
+        META_NODISCARD uint64_t min() const noexcept
+        {
+            return m_count ? m_min : 0;
+        }
+
+        META_NODISCARD uint64_t max() const noexcept
+        {
+            return m_max;
+        }
+
+        META_NODISCARD uint64_t mean() const noexcept
+        {
+            return m_count ? m_total / m_count : 0;
+        }
+
+        // fraction in [0, 1], e.g. 0.99 for p99
+        META_NODISCARD uint64_t percentile(double fraction) const noexcept
+        {
+            if (m_count == 0)
+                return 0;
+
+            auto rank = static_cast<uint64_t>(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(m_count - 1)) + 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BucketCount; ++i)
+            {
+                seen += m_histogram[i];
+                if (seen >= rank)
+                    return std::clamp(bucketMiddle(i), m_min, m_max);
+            }
+            return m_max;
+        }
+
+    private:
+        static constexpr uint32_t SubBits = 4; // 16 buckets per power of two
+        static constexpr size_t BucketCount = (64 - SubBits + 1) << SubBits;
+
+        uint64_t m_count = 0;
+        uint64_t m_total = 0;
+        uint64_t m_self = 0;
+        uint64_t m_min = UINT64_MAX;
+        uint64_t m_max = 0;
+        uint32_t m_histogram[BucketCount] = {};
+
+        // Values below 16 get a bucket each; above, the top SubBits bits after the leading one pick the bucket
+        static size_t bucketOf(uint64_t value) noexcept
+        {
+            if (value < (1u << SubBits))
+                return static_cast<size_t>(value);
+            auto exponent = static_cast<uint32_t>(std::bit_width(value)) - 1;
+            auto sub = static_cast<size_t>((value >> (exponent - SubBits)) & ((1u << SubBits) - 1));
+            return ((exponent - SubBits + 1) << SubBits) + sub;
+        }
+
+        static uint64_t bucketMiddle(size_t bucket) noexcept
+        {
+            if (bucket < (1u << SubBits))
+                return bucket;
+            uint32_t exponent = static_cast<uint32_t>(bucket >> SubBits) + SubBits - 1;
+            uint64_t sub = bucket & ((1u << SubBits) - 1);
+            uint64_t low = (uint64_t{ 1 } << exponent) | (sub << (exponent - SubBits));
+            return low + (uint64_t{ 1 } << (exponent - SubBits)) / 2;
+        }
+    };
+
+    // A scope reached through one particular chain of enclosing scopes; merged across threads
+    struct ProfileNode
+    {
+        const ProfileSite* site = nullptr; // null for the root
+        ProfileStats stats;
+        std::vector<std::unique_ptr<ProfileNode>> children;
+
+        ProfileNode* child(const ProfileSite* childSite)
+        {
+            for (auto& node : children)
+            {
+                if (node->site == childSite)
+                    return node.get();
+            }
+            children.push_back(std::make_unique<ProfileNode>());
+            children.back()->site = childSite;
+            return children.back().get();
+        }
+    };
+
+    // Aggregates the scopes recorded by all threads into a call tree and, while a trace runs, keeps them with the
+    // counters and instants as a timeline. Recording never waits for the collector; call collect() often enough (e.g.
+    // once per frame) that the per-thread buffers do not fill up.
+    class Profiler
+    {
+    public:
+        static Profiler& instance()
+        {
+            static Profiler profiler;
+            return profiler;
+        }
+
+        // Moves the events recorded since the previous call into the call tree
+        void collect()
+        {
+            std::lock_guard lock(m_mutex);
+
+            std::vector<std::shared_ptr<internal::ThreadProfileBuffer>> buffers;
+            {
+                auto& registry = internal::ProfilerRegistry::instance();
+                std::lock_guard registryLock(registry.mutex);
+                buffers = registry.buffers;
+            }
+
+            for (auto& buffer : buffers)
+            {
+                // Read before draining, so events written just before the thread exited are not missed
+                bool finished = buffer->finished.load(std::memory_order_acquire);
+                auto& frames = m_frames[buffer.get()];
+                uint32_t thread = buffer->threadId();
+                buffer->drain([&](const internal::ProfileEvent& event) { apply(frames, thread, event); });
+                if (m_tracing)
+                    m_traceThreads.try_emplace(thread, buffer->threadName());
+                m_dropped += buffer->takeDropped();
+
+                if (finished)
+                    release(buffer.get());
+            }
+        }
+
+        // Forgets everything collected so far. Scopes open at that moment are counted from where they end up next.
+        void reset()
+        {
+            std::lock_guard lock(m_mutex);
+            m_root = ProfileNode{};
+            m_dropped = 0;
+            for (auto& [buffer, frames] : m_frames)
+                frames.clear();
+        }
+
+        // Starts keeping a timeline of what collect() sees: the last `capacity` completed scopes, counter values and
+        // instants, older ones overwritten first. Scopes already open are left out.
+        void startTrace(size_t capacity = META_PROFILER_TRACE_SIZE)
+        {
+            std::lock_guard lock(m_mutex);
+            m_trace.assign(std::max<size_t>(capacity, 1), TraceEvent{});
+            m_traceNext = 0;
+            m_traceCount = 0;
+            m_traceThreads.clear();
+            m_tracing = true;
+        }
+
+        // Keeps the timeline recorded so far for writeTrace()
+        void stopTrace()
+        {
+            std::lock_guard lock(m_mutex);
+            m_tracing = false;
+        }
+
+        META_NODISCARD bool tracing() const noexcept
+        {
+            return m_tracing;
+        }
+
+        // Writes the timeline in the Chrome trace event format, which chrome://tracing and ui.perfetto.dev open.
+        // Call collect() first so the latest events are included.
+        void writeTrace(std::ostream& out)
+        {
+            std::lock_guard lock(m_mutex);
+
+            size_t first = m_traceCount < m_trace.size() ? 0 : m_traceNext;
+            int64_t origin = INT64_MAX;
+            for (size_t i = 0; i < m_traceCount; ++i)
+                origin = std::min(origin, m_trace[(first + i) % m_trace.size()].time);
+
+            out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            bool separator = false;
+            auto next = [&]() -> std::ostream&
+            {
+                if (separator)
+                    out << ",\n";
+                separator = true;
+                return out;
+            };
+
+            for (const auto& [thread, name] : m_traceThreads)
+            {
+                next() << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << thread
+                       << ",\"args\":{\"name\":\"";
+                if (name.empty())
+                    out << "thread " << thread;
+                else
+                    internal::writeJsonString(out, name.view());
+                out << "\"}}";
+            }
+
+            char number[64];
+            auto micros = [&](int64_t ns)
+            {
+                std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(ns) / 1000.0);
+                return number;
+            };
+
+            for (size_t i = 0; i < m_traceCount; ++i)
+            {
+                const TraceEvent& event = m_trace[(first + i) % m_trace.size()];
+                next() << "{\"name\":\"";
+                internal::writeJsonString(out, event.site->name);
+                out << "\",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":" << micros(event.time - origin);
+
+                switch (event.kind)
+                {
+                case internal::ProfileEvent::Kind::End:
+                    out << ",\"ph\":\"X\",\"dur\":" << micros(static_cast<int64_t>(event.value)) << "}";
+                    break;
+                case internal::ProfileEvent::Kind::Counter:
+                    std::snprintf(number, sizeof(number), "%.17g", event.value);
+                    out << ",\"ph\":\"C\",\"args\":{\"value\":" << number << "}}";
+                    break;
+                default:
+                    out << ",\"ph\":\"i\",\"s\":\"t\"}";
+                    break;
+                }
+            }
+            out << "]}\n";
+        }
+
+        // Calls func(node, depth) for every node below the root, parents before children. Do not run concurrently
+        // with collect() or reset().
+        template <typename Func> void forEach(Func&& func) const
+        {
+            for (auto& child : m_root.children)
+                visit(*child, 0, func);
+        }
+
+        META_NODISCARD const ProfileNode& root() const noexcept
+        {
+            return m_root;
+        }
+
+        // Scopes not recorded because a thread's buffer was full
+        META_NODISCARD uint64_t dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+        // Indented call tree with one line per node, times in microseconds
+        void print(std::ostream& out = std::cout) const
+        {
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-40s %10s %12s %12s %10s %10s %10s %10s\n", "scope", "count",
+                          "total", "self", "min", "p50", "p99", "max");
+            out << line;
+
+            forEach(
+                [&](const ProfileNode& node, size_t depth)
+                {
+                    const ProfileStats& stats = node.stats;
+                    auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+                    int indent = static_cast<int>(std::min<size_t>(depth * 2, 20));
+                    int width = 40 - indent;
+                    int length = static_cast<int>(std::min<size_t>(node.site->name.size(), width));
+                    std::snprintf(line, sizeof(line), "%*s%-*.*s %10llu %12.1f %12.1f %10.2f %10.2f %10.2f %10.2f\n",
+                                  indent, "", width, length, node.site->name.data(),
+                                  static_cast<unsigned long long>(stats.count()), us(stats.total()), us(stats.self()),
+                                  us(stats.min()), us(stats.percentile(0.5)), us(stats.percentile(0.99)),
+                                  us(stats.max()));
+                    out << line;
+                });
+
+            if (m_dropped > 0)
+                out << m_dropped << " scopes dropped (buffer full)\n";
+        }
+
+    private:
+        // A completed scope (End, value is the duration), counter or instant of the timeline
+        struct TraceEvent
+        {
+            const ProfileSite* site = nullptr;
+            int64_t time = 0; // begin of a scope
+            double value = 0.0;
+            uint32_t thread = 0;
+            internal::ProfileEvent::Kind kind = internal::ProfileEvent::Kind::End;
+        };
+
+        // A scope of one thread that has begun but not ended yet
+        struct Frame
+        {
+            ProfileNode* node;
+            int64_t begin;
+            int64_t children; // time spent in profiled children
+        };
+
+        std::mutex m_mutex;
+        ProfileNode m_root;
+        std::unordered_map<internal::ThreadProfileBuffer*, std::vector<Frame>> m_frames;
+        uint64_t m_dropped = 0;
+
+        std::vector<TraceEvent> m_trace; // ring
+        size_t m_traceNext = 0;
+        size_t m_traceCount = 0;
+        std::map<uint32_t, Atom> m_traceThreads;
+        std::atomic<bool> m_tracing{ false };
+
+        Profiler() = default;
+
+        void apply(std::vector<Frame>& frames, uint32_t thread, const internal::ProfileEvent& event)
+        {
+            switch (event.kind)
+            {
+            case internal::ProfileEvent::Kind::Begin: {
+                ProfileNode* parent = frames.empty() ? &m_root : frames.back().node;
+                frames.push_back({ parent->child(event.site), event.time, 0 });
+                return;
+            }
+            case internal::ProfileEvent::Kind::End:
+                break;
+            default:
+                trace({ event.site, event.time, event.value, thread, event.kind });
+                return;
+            }
+
+            // Ends of scopes that began before reset() have no frame
+            if (frames.empty() || frames.back().node->site != event.site)
+                return;
+
+            Frame frame = frames.back();
+            frames.pop_back();
+            int64_t duration = event.time - frame.begin;
+            frame.node->stats.add(duration, duration - frame.children);
+            if (!frames.empty())
+                frames.back().children += duration;
+            trace({ event.site, frame.begin, static_cast<double>(duration), thread, event.kind });
+        }
+
+        void trace(const TraceEvent& event)
+        {
+            if (!m_tracing.load(std::memory_order_relaxed))
+                return;
+            m_trace[m_traceNext] = event;
+            m_traceNext = (m_traceNext + 1) % m_trace.size();
+            m_traceCount = std::min(m_traceCount + 1, m_trace.size());
+        }
+
+        void release(internal::ThreadProfileBuffer* buffer)
+        {
+            m_frames.erase(buffer);
+
+            auto& registry = internal::ProfilerRegistry::instance();
+            std::lock_guard lock(registry.mutex);
+            std::erase_if(registry.buffers, [buffer](const auto& entry) { return entry.get() == buffer; });
+        }
+
+        template <typename Func> static void visit(const ProfileNode& node, size_t depth, Func& func)
+        {
+            func(node, depth);
+            for (auto& child : node.children)
+                visit(*child, depth + 1, func);
+        }
+    };
+} // namespace meta
+
+#define META_PROFILE_CONCAT_IMPL(a, b) a##b
+#define META_PROFILE_CONCAT(a, b) META_PROFILE_CONCAT_IMPL(a, b)
+
+// Timeline markers for traces, e.g. META_PROFILE_COUNTER("queued tasks", count); or META_PROFILE_INSTANT("resize");
+// Like META_PROFILE_SCOPE (ScopeTimer.hpp) they expand to nothing unless META_PROFILER is 1.
+#if META_PROFILER
+#define META_PROFILE_COUNTER(name, value)                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static constexpr ::meta::ProfileSite metaProfileSite{ name, __FILE__, __LINE__ };                              \
+        ::meta::internal::profileMark(metaProfileSite, ::meta::internal::ProfileEvent::Kind::Counter,                  \
+                                      static_cast<double>(value));                                                     \
+    } while (0)
+#define META_PROFILE_INSTANT(name)                                                                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static constexpr ::meta::ProfileSite metaProfileSite{ name, __FILE__, __LINE__ };                              \
+        ::meta::internal::profileMark(metaProfileSite, ::meta::internal::ProfileEvent::Kind::Instant, 0.0);            \
+    } while (0)
+#else
+#define META_PROFILE_COUNTER(name, value) static_cast<void>(0)
+#define META_PROFILE_INSTANT(name) static_cast<void>(0)
+#endif
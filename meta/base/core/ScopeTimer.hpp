@@ -3,12 +3,15 @@
 #include <chrono>
 #include <iostream>
 #include <meta/base/core/Platform.hpp>
+#include <meta/base/core/Profiler.hpp>
 #include <meta/base/core/Timer.hpp>
 #include <string_view>
 
 namespace meta
 {
-    template <typename DurationTag = Milliseconds> class ScopeTimer
+    // Prints the time spent in a scope when it ends. For measurements inside hot or production code use
+    // META_PROFILE_SCOPE below, which records into the Profiler instead of writing to the console.
+    template <typename DurationTag = Milliseconds, typename ClockType = std::chrono::steady_clock> class ScopeTimer
     {
     public:
         META_INLINE explicit ScopeTimer(std::string_view label = {}) noexcept : m_label(label), m_start(Clock::now())
@@ -31,12 +34,12 @@ namespace meta
         }
 
     private:
-        using Clock = std::chrono::high_resolution_clock;
-        Clock::time_point m_start;
+        using Clock = ClockType;
         std::string_view m_label;
+        typename Clock::time_point m_start;
 
         // Compile-time optimized conversion
-        META_FORCE_INLINE constexpr double to_seconds(Clock::duration d) const noexcept
+        META_FORCE_INLINE constexpr double to_seconds(typename Clock::duration d) const noexcept
         {
             if constexpr (std::is_same_v<DurationTag, Seconds>)
                 return std::chrono::duration<double>(d).count();
@@ -64,4 +67,39 @@ namespace meta
                 return "ms";
         }
     };
+
+    // Scope timer of the profiling mode: records its begin and end into the calling thread's profiler buffer
+    class ProfileScope
+    {
+    public:
+        META_FORCE_INLINE explicit ProfileScope(const ProfileSite& site) noexcept
+            : m_site(&site), m_buffer(internal::threadProfileBuffer())
+        {
+            if (!m_buffer.begin(m_site, internal::profileNow()))
+                m_site = nullptr;
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        META_FORCE_INLINE ~ProfileScope() noexcept
+        {
+            if (m_site)
+                m_buffer.end(m_site, internal::profileNow());
+        }
+
+    private:
+        const ProfileSite* m_site;
+        internal::ThreadProfileBuffer& m_buffer;
+    };
 } // namespace meta
+
+// Profiles the rest of the enclosing scope under a constant name, e.g. META_PROFILE_SCOPE("layout");
+// Expands to nothing unless META_PROFILER is 1.
+#if META_PROFILER
+#define META_PROFILE_SCOPE(name)                                                                                       \
+    static constexpr ::meta::ProfileSite META_PROFILE_CONCAT(metaProfileSite, __LINE__){ name, __FILE__, __LINE__ };   \
+    ::meta::ProfileScope META_PROFILE_CONCAT(metaProfileScope, __LINE__)(META_PROFILE_CONCAT(metaProfileSite, __LINE__))
+#else
+#define META_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
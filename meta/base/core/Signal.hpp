@@ -1,49 +1,107 @@
 #pragma once
 
-#include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <meta/base/core/InplaceFunction.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// Bytes available inline to each slot's callable; a lambda capturing more than this is kept on the heap
+#ifndef META_SIGNAL_SLOT_CAPACITY
+#define META_SIGNAL_SLOT_CAPACITY 48
+#endif
+
 namespace meta
 {
+    // Slots live in a dense array that emit() walks front to back. Disconnecting swaps the last slot into the freed
+    // place, so the call order is only the connection order until the first disconnect. Connecting or disconnecting
+    // from inside a slot is allowed: the change is applied once the outermost emit() returns.
+    // The slots are kept in a block shared with the connections (allocated on the first connect), so a Connection
+    // may outlive its Signal and a Signal may be moved without breaking the connections made to it.
+    // A Signal is not thread-safe: emit, connect and disconnect must happen on one thread. To emit from other threads,
+    // or to have slots run on an EventLoop's thread, use ConcurrentSignal.
     template <typename... Args> class Signal
     {
     public:
-        using SlotType = std::function<void(Args...)>;
+        static constexpr size_t SlotCapacity = META_SIGNAL_SLOT_CAPACITY;
+        using SlotType = InplaceFunction<void(Args...), SlotCapacity>;
+
+    private:
+        struct State;
 
+    public:
+        // Refers to one slot. Disconnecting twice, after the signal is gone or after the slot's id was reused by a
+        // later connection is a no-op.
         class Connection
         {
         public:
-            Connection(Signal* sig, size_t id) : signal(sig), id(id)
+            Connection() = default;
+
+            Connection(std::weak_ptr<State> state, uint64_t id) : state(std::move(state)), id(id)
             {
             }
+
             void disconnect()
             {
-                if (signal)
-                    signal->disconnect(id);
+                if (auto target = state.lock())
+                    target->disconnect(id);
+                state.reset();
+            }
+
+            META_NODISCARD bool connected() const
+            {
+                auto target = state.lock();
+                return target && target->isConnected(id);
             }
 
         private:
-            Signal* signal = nullptr;
-            size_t id = 0;
+            std::weak_ptr<State> state;
+            uint64_t id = 0;
         };
 
+        Signal() = default;
+
+        Signal(const Signal&) = delete;
+        Signal& operator=(const Signal&) = delete;
+
+        // The moved-from signal is left without slots
+        Signal(Signal&& other) noexcept = default;
+
+        Signal& operator=(Signal&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                state = std::move(other.state);
+            }
+            return *this;
+        }
+
+        ~Signal()
+        {
+            release();
+        }
+
         // Connect a callable to this signal
-        Connection connect(SlotType&& slot)
+        template <typename Func>
+            requires std::invocable<std::decay_t<Func>&, Args...>
+        Connection connect(Func&& slot)
         {
-            size_t id = nextId++;
-            slots.emplace_back(id, std::move(slot));
-            return Connection(this, id);
+            if (!state)
+                state = std::make_shared<State>();
+            return Connection(state, state->connect(SlotType::fitOrBox(std::forward<Func>(slot))));
         }
 
-        // Emit the signal to all connected slots
+        // Emit the signal to all connected slots. A slot may destroy the signal; the slots are kept alive until the
+        // emission ends, and the remaining ones are still called.
         void emit(Args... args)
         {
-            for (auto& [id, slot] : slots)
-            {
-                if (slot)
-                    slot(args...);
-            }
+            if (state)
+                state->emit(args...);
         }
 
         void operator()(Args... args)
@@ -52,22 +110,207 @@ namespace meta
         }
 
     private:
-        void disconnect(size_t id)
+        struct Slot
         {
-            auto it = std::remove_if(slots.begin(), slots.end(), [id](const auto& pair) { return pair.first == id; });
-            slots.erase(it, slots.end());
-        }
+            template <typename Func>
+            Slot(Func&& slot, uint64_t slotId) : function(std::forward<Func>(slot)), id(slotId)
+            {
+            }
+
+            SlotType function;
+            uint64_t id; // generation << 32 | index into ids; 0 once disconnected during emission
+        };
+
+        struct IdEntry
+        {
+            uint32_t generation = 1; // bumped on disconnect, so ids handed out earlier stop matching
+            uint32_t position = 0;   // index into slots, or into added with AddedFlag set
+        };
+
+        static constexpr uint32_t AddedFlag = 0x80000000u;
+
+        struct State
+        {
+            std::vector<Slot> slots;
+            std::vector<Slot> added; // connected while emitting
+            std::vector<IdEntry> ids;
+            std::vector<uint32_t> freeIds;
+            uint32_t emitting = 0;
+            bool hasDisconnected = false;
+            std::shared_ptr<State> keepAlive; // set when the signal lets go of its state during an emission
+
+            // Applies changes deferred while slots were running once the outermost emit() ends, even if a slot throws
+            struct EmitScope
+            {
+                explicit EmitScope(State& owner) : state(owner)
+                {
+                    ++state.emitting;
+                }
+
+                ~EmitScope()
+                {
+                    if (--state.emitting > 0)
+                        return;
+                    if (state.hasDisconnected || !state.added.empty())
+                        state.settle();
+                    // Frees the state if the signal is gone; nothing touches it afterwards
+                    if (state.keepAlive)
+                        auto released = std::move(state.keepAlive);
+                }
+
+                State& state;
+            };
+
+            void emit(Args... args)
+            {
+                EmitScope scope(*this);
+                size_t count = slots.size();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (slots[i].id != 0)
+                        slots[i].function(args...);
+                }
+            }
+
+            template <typename Func> uint64_t connect(Func&& slot)
+            {
+                uint64_t id = allocateId();
+                auto index = static_cast<uint32_t>(id);
+                if (emitting > 0)
+                {
+                    ids[index].position = static_cast<uint32_t>(added.size()) | AddedFlag;
+                    added.emplace_back(std::forward<Func>(slot), id);
+                }
+                else
+                {
+                    ids[index].position = static_cast<uint32_t>(slots.size());
+                    slots.emplace_back(std::forward<Func>(slot), id);
+                }
+                return id;
+            }
+
+            bool isConnected(uint64_t id) const noexcept
+            {
+                auto index = static_cast<uint32_t>(id);
+                return index < ids.size() && ids[index].generation == static_cast<uint32_t>(id >> 32);
+            }
+
+            // O(1): the id leads straight to the slot, which is swapped with the last one
+            void disconnect(uint64_t id)
+            {
+                if (!isConnected(id))
+                    return;
+
+                auto index = static_cast<uint32_t>(id);
+                uint32_t position = ids[index].position;
+                if (++ids[index].generation == 0)
+                    ids[index].generation = 1;
+                freeIds.push_back(index);
+
+                if (position & AddedFlag)
+                {
+                    removeAt(added, position & ~AddedFlag, AddedFlag);
+                }
+                else if (emitting > 0)
+                {
+                    // The slot may be running right now; it is removed once emission ends
+                    slots[position].id = 0;
+                    hasDisconnected = true;
+                }
+                else
+                {
+                    removeAt(slots, position, 0);
+                }
+            }
+
+            uint64_t allocateId()
+            {
+                uint32_t index;
+                if (!freeIds.empty())
+                {
+                    index = freeIds.back();
+                    freeIds.pop_back();
+                }
+                else
+                {
+                    index = static_cast<uint32_t>(ids.size());
+                    ids.emplace_back();
+                }
+                return (static_cast<uint64_t>(ids[index].generation) << 32) | index;
+            }
+
+            void removeAt(std::vector<Slot>& list, uint32_t position, uint32_t flag)
+            {
+                if (position + 1 != list.size())
+                {
+                    list[position] = std::move(list.back());
+                    if (list[position].id != 0)
+                        ids[static_cast<uint32_t>(list[position].id)].position = position | flag;
+                }
+                list.pop_back();
+            }
 
-        std::vector<std::pair<size_t, SlotType>> slots;
-        size_t nextId = 1;
+            void settle()
+            {
+                if (hasDisconnected)
+                {
+                    for (size_t i = slots.size(); i-- > 0;)
+                    {
+                        if (slots[i].id == 0)
+                            removeAt(slots, static_cast<uint32_t>(i), 0);
+                    }
+                    hasDisconnected = false;
+                }
+
+                for (auto& slot : added)
+                {
+                    ids[static_cast<uint32_t>(slot.id)].position = static_cast<uint32_t>(slots.size());
+                    slots.push_back(std::move(slot));
+                }
+                added.clear();
+            }
+        };
+
+        std::shared_ptr<State> state;
+
+        // Drops the state, unless a slot running right now (and destroying or reassigning this signal) still needs it;
+        // the outermost emit() then releases it when it ends. Cheaper than a reference held by every emit().
+        void release() noexcept
+        {
+            if (state && state->emitting > 0)
+            {
+                State& current = *state;
+                current.keepAlive = std::move(state);
+            }
+            state.reset();
+        }
     };
 
+    // Disconnects when destroyed. Safe even if the signal is already gone.
     template <typename SignalType> class ScopedConnection
     {
     public:
+        ScopedConnection() = default;
+
         ScopedConnection(SignalType::Connection conn) : connection(std::move(conn))
         {
         }
+
+        ScopedConnection(ScopedConnection&&) noexcept = default;
+
+        ScopedConnection& operator=(ScopedConnection&& other) noexcept
+        {
+            if (this != &other)
+            {
+                connection.disconnect();
+                connection = std::move(other.connection);
+            }
+            return *this;
+        }
+
+        ScopedConnection(const ScopedConnection&) = delete;
+        ScopedConnection& operator=(const ScopedConnection&) = delete;
+
         ~ScopedConnection()
         {
             connection.disconnect();
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/StringView.hpp>
+#include <ranges>
+#include <utility>
+
+namespace meta
+{
+    namespace internal
+    {
+        // Delimiter policies: return the position and length of the next delimiter in text, or npos
+        struct CharDelimiter
+        {
+            char c;
+
+            META_INLINE std::pair<size_t, size_t> next(StringView text) const noexcept
+            {
+                return { text.find(c), 1 };
+            }
+        };
+
+        struct StringDelimiter
+        {
+            StringView delimiter;
+
+            META_INLINE std::pair<size_t, size_t> next(StringView text) const noexcept
+            {
+                if (delimiter.empty())
+                    return { StringView::npos, 0 };
+                return { text.find(delimiter), delimiter.size() };
+            }
+        };
+
+        struct AnyOfDelimiter
+        {
+            StringView chars;
+
+            META_INLINE std::pair<size_t, size_t> next(StringView text) const noexcept
+            {
+                return { text.findFirstOf(chars), 1 };
+            }
+        };
+
+        enum class SplitMode
+        {
+            Split,  // every piece, including empty ones
+            Lines,  // like std::getline: no trailing empty line, "\r\n" accepted
+            Tokens, // empty pieces are skipped
+        };
+    } // namespace internal
+
+    // Lazy forward range of StringView pieces. Pieces point into the original text, which must outlive the range.
+    // Delimiters are located with the SIMD search kernels, so nothing is copied or allocated while iterating.
+    template <typename Delimiter, internal::SplitMode Mode>
+    class SplitRange : public std::ranges::view_interface<SplitRange<Delimiter, Mode>>
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = StringView;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+
+            META_INLINE Iterator() noexcept = default;
+
+            META_INLINE Iterator(StringView text, Delimiter delimiter) noexcept
+                : m_rest(text), m_delimiter(delimiter), m_atEnd(text.empty())
+            {
+                if (!m_atEnd)
+                    advance();
+            }
+
+            META_NODISCARD META_INLINE StringView operator*() const noexcept
+            {
+                return m_current;
+            }
+
+            META_INLINE Iterator& operator++() noexcept
+            {
+                advance();
+                return *this;
+            }
+
+            META_INLINE Iterator operator++(int) noexcept
+            {
+                Iterator copy = *this;
+                advance();
+                return copy;
+            }
+
+            friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+            {
+                if (lhs.m_atEnd || rhs.m_atEnd)
+                    return lhs.m_atEnd == rhs.m_atEnd;
+                return lhs.m_current.data() == rhs.m_current.data() && lhs.m_current.size() == rhs.m_current.size();
+            }
+
+            friend bool operator==(const Iterator& it, std::default_sentinel_t) noexcept
+            {
+                return it.m_atEnd;
+            }
+
+        private:
+            StringView m_rest;
+            StringView m_current;
+            Delimiter m_delimiter{};
+            bool m_atEnd = true;
+            bool m_last = false;
+
+            META_INLINE void advance() noexcept
+            {
+                do
+                {
+                    if (m_last)
+                    {
+                        m_atEnd = true;
+                        return;
+                    }
+
+                    auto [pos, length] = m_delimiter.next(m_rest);
+                    if (pos == StringView::npos)
+                    {
+                        m_current = m_rest;
+                        m_rest = StringView(m_rest.end(), 0);
+                        m_last = true;
+                    }
+                    else
+                    {
+                        m_current = m_rest.substr(0, pos);
+                        m_rest.removePrefix(pos + length);
+                        if constexpr (Mode == internal::SplitMode::Lines)
+                            m_last = m_rest.empty();
+                    }
+
+                    if constexpr (Mode == internal::SplitMode::Lines)
+                        if (!m_current.empty() && m_current.back() == '\r')
+                            m_current.removeSuffix(1);
+                } while (Mode == internal::SplitMode::Tokens && m_current.empty());
+            }
+        };
+
+        META_INLINE SplitRange() noexcept = default;
+
+        META_INLINE SplitRange(StringView text, Delimiter delimiter) noexcept : m_text(text), m_delimiter(delimiter)
+        {
+        }
+
+        META_NODISCARD META_INLINE Iterator begin() const noexcept
+        {
+            return Iterator(m_text, m_delimiter);
+        }
+
+        META_NODISCARD META_INLINE std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        StringView m_text;
+        Delimiter m_delimiter{};
+    };
+
+    // Pieces between each delimiter, e.g. split("a,,b", ',') yields "a", "", "b"
+    META_NODISCARD META_INLINE auto split(StringView text, char delimiter) noexcept
+    {
+        return SplitRange<internal::CharDelimiter, internal::SplitMode::Split>(text, { delimiter });
+    }
+
+    META_NODISCARD META_INLINE auto split(StringView text, StringView delimiter) noexcept
+    {
+        return SplitRange<internal::StringDelimiter, internal::SplitMode::Split>(text, { delimiter });
+    }
+
+    // Lines without their terminator; a final newline does not produce an extra empty line
+    META_NODISCARD META_INLINE auto lines(StringView text) noexcept
+    {
+        return SplitRange<internal::CharDelimiter, internal::SplitMode::Lines>(text, { '\n' });
+    }
+
+    // Non-empty runs of characters not in separators, e.g. tokenize(" a  b\t", " \t") yields "a", "b"
+    META_NODISCARD META_INLINE auto tokenize(StringView text, StringView separators) noexcept
+    {
+        return SplitRange<internal::AnyOfDelimiter, internal::SplitMode::Tokens>(text, { separators });
+    }
+
+    static_assert(std::ranges::forward_range<SplitRange<internal::CharDelimiter, internal::SplitMode::Split>>);
+    static_assert(std::ranges::view<SplitRange<internal::CharDelimiter, internal::SplitMode::Split>>);
+} // namespace meta
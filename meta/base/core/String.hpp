@@ -4,12 +4,19 @@
 #include <array>
 #include <cctype>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <meta/base/core/Hash.hpp>
 #include <meta/base/core/Platform.hpp>
+#include <meta/base/core/StringSearch.hpp>
+#include <meta/base/core/StringView.hpp>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace meta
 {
@@ -18,28 +25,19 @@ namespace meta
     public:
         static constexpr size_t npos = SIZE_MAX;
 
-        META_INLINE String() noexcept : m_size(0)
+        META_INLINE String() noexcept
         {
+            initLocal();
         }
 
-        META_INLINE String(const char* s)
+        META_INLINE String(const char* s) : String(std::string_view(s))
         {
-            size_t i = 0;
-            while (s[i] != '\0' && i < N)
-                m_buffer[i] = s[i], ++i;
-            m_size = i;
-            m_buffer[m_size] = '\0';
         }
 
         META_INLINE String(std::string_view sv)
         {
-            if (sv.size() <= N)
-            {
-                m_size = sv.size();
-                std::copy_n(sv.data(), m_size, m_buffer.data());
-            }
-            else
-                m_runtime = std::make_unique<std::string>(sv);
+            initLocal();
+            append(sv.data(), sv.size());
         }
 
         META_INLINE String(const std::string& s) : String(std::string_view(s))
@@ -49,32 +47,29 @@ namespace meta
         {
         }
 
-        META_INLINE String(const String& other) : m_size(other.m_size)
+        META_INLINE String(const String& other) : String(std::string_view(other))
         {
-            if (other.m_runtime)
-                m_runtime = std::make_unique<std::string>(*other.m_runtime);
-            else
-                std::copy_n(other.m_buffer.data(), m_size, m_buffer.data());
         }
 
-        META_INLINE String(String&& other) noexcept : m_size(other.m_size), m_runtime(std::move(other.m_runtime))
+        template <size_t M> META_INLINE String(const String<M>& other) : String(std::string_view(other))
         {
-            if (!m_runtime)
-                std::copy_n(other.m_buffer.data(), m_size, m_buffer.data());
+        }
+
+        META_INLINE String(String&& other) noexcept
+        {
+            steal(other);
+        }
+
+        META_INLINE ~String()
+        {
+            release();
         }
 
         META_INLINE String& operator=(const String& other)
         {
             if (this == &other)
                 return *this;
-            m_size = other.m_size;
-            if (other.m_runtime)
-                m_runtime = std::make_unique<std::string>(*other.m_runtime);
-            else
-            {
-                m_runtime = nullptr;
-                std::copy_n(other.m_buffer.data(), m_size, m_buffer.data());
-            }
+            assign(other.data(), other.size());
             return *this;
         }
 
@@ -82,21 +77,14 @@ namespace meta
         {
             if (this == &other)
                 return *this;
-            m_size = other.m_size;
-            m_runtime = std::move(other.m_runtime);
-            if (!m_runtime)
-                std::copy_n(other.m_buffer.data(), m_size, m_buffer.data());
+            release();
+            steal(other);
             return *this;
         }
 
         bool operator==(const String& rhs) const noexcept
         {
-            if (m_size != rhs.m_size)
-                return false;
-            for (size_t i = 0; i < m_size; ++i)
-                if ((*this)[i] != rhs[i])
-                    return false;
-            return true;
+            return size() == rhs.size() && std::memcmp(data(), rhs.data(), size()) == 0;
         }
 
         bool operator!=(const String& rhs) const noexcept
@@ -106,68 +94,43 @@ namespace meta
 
         template <size_t M> META_INLINE String<N>& operator+=(const String<M>& rhs)
         {
-            if (m_runtime || m_size + rhs.size() > N)
-            {
-                if (!m_runtime)
-                    m_runtime = std::make_unique<std::string>(std::string(m_buffer.data(), m_size));
-                m_runtime->append(rhs.data(), rhs.size());
-            }
-            else
-            {
-                for (size_t i = 0; i < rhs.size(); ++i)
-                    m_buffer[m_size + i] = rhs[i];
-                m_size += rhs.size();
-                m_buffer[m_size] = '\0';
-            }
+            append(rhs.data(), rhs.size());
             return *this;
         }
 
         META_INLINE String<N>& operator+=(std::string_view sv)
         {
-            if (m_runtime || m_size + sv.size() > N)
-            {
-                if (!m_runtime)
-                    m_runtime = std::make_unique<std::string>(std::string(m_buffer.data(), m_size));
-                m_runtime->append(sv.data(), sv.size());
-            }
-            else
-            {
-                for (size_t i = 0; i < sv.size(); ++i)
-                    m_buffer[m_size + i] = sv[i];
-                m_size += sv.size();
-                m_buffer[m_size] = '\0';
-            }
+            append(sv.data(), sv.size());
             return *this;
         }
 
         META_INLINE String<N>& operator+=(char c)
         {
-            if (m_runtime)
-                m_runtime->push_back(c);
-            else if (m_size + 1 <= N)
-                m_buffer[m_size++] = c, m_buffer[m_size] = '\0';
-            else
-                m_runtime = std::make_unique<std::string>(std::string(m_buffer.data(), m_size) + c);
+            append(&c, 1);
             return *this;
         }
 
         template <size_t M> META_INLINE String<> operator+(const String<M>& rhs) const
         {
-            return String<>(toString() + rhs.toString());
+            return concat(rhs);
         }
 
         META_INLINE String<> operator+(std::string_view sv) const
         {
-            return String<>(toString() + std::string(sv));
+            return concat(sv);
         }
         META_INLINE String<> operator+(const char* rhs) const
         {
-            return String<>(toString() + std::string(rhs));
+            return concat(std::string_view(rhs));
         }
 
         META_NODISCARD META_INLINE size_t size() const noexcept
         {
-            return m_runtime ? m_runtime->size() : m_size;
+            return onHeap() ? m_heap.size : m_local.size;
+        }
+        META_NODISCARD META_INLINE size_t capacity() const noexcept
+        {
+            return onHeap() ? m_heap.capacity : N;
         }
         META_NODISCARD META_INLINE bool empty() const noexcept
         {
@@ -175,7 +138,7 @@ namespace meta
         }
         META_NODISCARD META_INLINE const char* data() const noexcept
         {
-            return m_runtime ? m_runtime->data() : m_buffer.data();
+            return onHeap() ? m_heap.data : m_local.data;
         }
         META_NODISCARD META_INLINE const char* c_str() const noexcept
         {
@@ -183,15 +146,15 @@ namespace meta
         }
         META_NODISCARD META_INLINE char operator[](size_t idx) const noexcept
         {
-            return m_runtime ? (*m_runtime)[idx] : m_buffer[idx];
+            return data()[idx];
         }
         META_NODISCARD META_INLINE operator std::string_view() const noexcept
         {
-            return m_runtime ? std::string_view(*m_runtime) : std::string_view(m_buffer.data(), m_size);
+            return std::string_view(data(), size());
         }
         META_NODISCARD META_INLINE std::string toString() const
         {
-            return m_runtime ? *m_runtime : std::string(m_buffer.data(), m_size);
+            return std::string(data(), size());
         }
 
         META_NODISCARD META_INLINE String substr(size_t pos, size_t len = npos) const
@@ -202,6 +165,22 @@ namespace meta
             return String(std::string_view(data() + pos, actualLen));
         }
 
+        // Non-owning variants of substr/trim that slice without copying
+        META_NODISCARD META_INLINE StringView view() const noexcept
+        {
+            return StringView(data(), size());
+        }
+
+        META_NODISCARD META_INLINE StringView substrView(size_t pos, size_t len = npos) const noexcept
+        {
+            return view().substr(pos, len);
+        }
+
+        META_NODISCARD META_INLINE StringView trimView() const noexcept
+        {
+            return view().trim();
+        }
+
         META_INLINE String& trim()
         {
             size_t start = 0;
@@ -212,38 +191,74 @@ namespace meta
             while (end > start && std::isspace(static_cast<unsigned char>((*this)[end - 1])))
                 --end;
 
-            *this = substr(start, end - start);
+            // Shift in place; the range is always within our own buffer
+            std::memmove(mutableData(), data() + start, end - start);
+            setSize(end - start);
             return *this;
         }
 
+        META_NODISCARD META_INLINE size_t find(char c, size_t pos = 0) const noexcept
+        {
+            if (pos >= size())
+                return npos;
+            size_t found = search::findChar(data() + pos, size() - pos, c);
+            return found == npos ? npos : pos + found;
+        }
+
+        META_NODISCARD META_INLINE size_t find(std::string_view str, size_t pos = 0) const noexcept
+        {
+            if (pos > size())
+                return npos;
+            size_t found = search::find(data() + pos, size() - pos, str.data(), str.size());
+            return found == npos ? npos : pos + found;
+        }
+
         META_NODISCARD META_INLINE size_t rfind(char c, size_t pos = npos) const noexcept
         {
             if (size() == 0)
                 return npos;
 
             size_t start = (pos == npos || pos >= size()) ? size() - 1 : pos;
-            for (size_t i = start + 1; i-- > 0;)
-                if ((*this)[i] == c)
-                    return i;
-            return npos;
+            return search::rfindChar(data(), start + 1, c);
         }
 
-        META_NODISCARD META_INLINE size_t rfind(const String<>& str, size_t pos = npos) const noexcept
+        META_NODISCARD META_INLINE size_t rfind(std::string_view str, size_t pos = npos) const noexcept
         {
             if (str.empty() || size() < str.size())
                 return npos;
 
             size_t start = (pos == npos || pos >= size() - str.size()) ? size() - str.size() : pos;
-            for (size_t i = start + 1; i-- > 0;)
-            {
-                bool match = true;
-                for (size_t j = 0; j < str.size(); ++j)
-                    if ((*this)[i + j] != str[j])
-                        match = false;
-                if (match)
-                    return i;
-            }
-            return npos;
+            return search::rfind(data(), start + str.size(), str.data(), str.size());
+        }
+
+        // Position of the first character that appears in chars
+        META_NODISCARD META_INLINE size_t findFirstOf(std::string_view chars, size_t pos = 0) const noexcept
+        {
+            if (pos >= size())
+                return npos;
+            size_t found = search::findFirstOf(data() + pos, size() - pos, chars.data(), chars.size());
+            return found == npos ? npos : pos + found;
+        }
+
+        META_NODISCARD META_INLINE size_t count(char c) const noexcept
+        {
+            return search::countChar(data(), size(), c);
+        }
+
+        // Number of non-overlapping occurrences of str
+        META_NODISCARD META_INLINE size_t count(std::string_view str) const noexcept
+        {
+            return search::count(data(), size(), str.data(), str.size());
+        }
+
+        META_NODISCARD META_INLINE bool contains(char c) const noexcept
+        {
+            return find(c) != npos;
+        }
+
+        META_NODISCARD META_INLINE bool contains(std::string_view str) const noexcept
+        {
+            return find(str) != npos;
         }
 
         friend std::ostream& operator<<(std::ostream& os, const String& str)
@@ -253,62 +268,191 @@ namespace meta
 
         META_INLINE void reserve(size_t newCapacity)
         {
-            if (newCapacity <= N)
+            if (newCapacity <= capacity())
                 return;
-            if (!m_runtime)
-                m_runtime = std::make_unique<std::string>(std::string(m_buffer.data(), m_size));
-            m_runtime->reserve(newCapacity);
+            reallocate(newCapacity);
+        }
+
+        // Empties the string but keeps its capacity for reuse
+        META_INLINE void clear() noexcept
+        {
+            setSize(0);
         }
 
         META_NODISCARD
         META_INLINE char& front() noexcept
         {
-            return m_runtime ? (*m_runtime)[0] : m_buffer[0];
+            return mutableData()[0];
         }
 
         META_NODISCARD
         META_INLINE const char& front() const noexcept
         {
-            return m_runtime ? (*m_runtime)[0] : m_buffer[0];
+            return data()[0];
         }
 
         META_NODISCARD
-        META_INLINE char& back() noexcept
+        META_INLINE char& back()
         {
             if (empty())
                 throw std::out_of_range("String is empty");
-            return m_runtime ? (*m_runtime)[m_runtime->size() - 1] : m_buffer[m_size - 1];
+            return mutableData()[size() - 1];
         }
 
         META_NODISCARD
-        META_INLINE const char& back() const noexcept
+        META_INLINE const char& back() const
         {
             if (empty())
                 throw std::out_of_range("String is empty");
-            return m_runtime ? (*m_runtime)[m_runtime->size() - 1] : m_buffer[m_size - 1];
+            return data()[size() - 1];
         }
 
         void popBack()
         {
-            if (m_size == 0)
+            if (empty())
                 return; // nothing to pop
 
-            if (m_runtime) // using heap string
+            setSize(size() - 1);
+        }
+
+    private:
+        // Smallest integer that can count up to N inline characters
+        using LocalSize =
+            std::conditional_t<(N <= UINT8_MAX), uint8_t, std::conditional_t<(N <= UINT16_MAX), uint16_t, size_t>>;
+
+        // Both representations start with the same tag, so it can be read through either member (common initial
+        // sequence). Inline storage and the heap pointer/capacity share the same bytes.
+        struct Local
+        {
+            bool onHeap;
+            LocalSize size;
+            char data[N + 1];
+        };
+
+        struct Heap
+        {
+            bool onHeap;
+            size_t size;
+            size_t capacity;
+            char* data;
+        };
+
+        union
+        {
+            Local m_local;
+            Heap m_heap;
+        };
+
+        META_FORCE_INLINE bool onHeap() const noexcept
+        {
+            return m_local.onHeap;
+        }
+
+        META_FORCE_INLINE char* mutableData() noexcept
+        {
+            return onHeap() ? m_heap.data : m_local.data;
+        }
+
+        META_FORCE_INLINE void initLocal() noexcept
+        {
+            m_local.onHeap = false;
+            m_local.size = 0;
+            m_local.data[0] = '\0';
+        }
+
+        META_FORCE_INLINE void setSize(size_t n) noexcept
+        {
+            if (onHeap())
+                m_heap.size = n;
+            else
+                m_local.size = static_cast<LocalSize>(n);
+            mutableData()[n] = '\0';
+        }
+
+        META_INLINE void release() noexcept
+        {
+            if (onHeap())
+                delete[] m_heap.data;
+        }
+
+        // Take over other's storage and leave it empty
+        META_INLINE void steal(String& other) noexcept
+        {
+            if (other.onHeap())
             {
-                m_runtime->pop_back();
-                --m_size;
+                m_heap = other.m_heap;
+                other.initLocal();
             }
-            else // using small buffer
+            else
             {
-                --m_size;
-                m_buffer[m_size] = '\0'; // clear the last char
+                initLocal();
+                std::memcpy(m_local.data, other.m_local.data, other.m_local.size + 1);
+                m_local.size = other.m_local.size;
             }
         }
 
-    private:
-        size_t m_size = 0;
-        std::array<char, N> m_buffer{};
-        std::unique_ptr<std::string> m_runtime{};
+        // Move the contents into a heap buffer of exactly newCapacity characters
+        META_INLINE void reallocate(size_t newCapacity)
+        {
+            size_t len = size();
+            char* buffer = new char[newCapacity + 1];
+            std::memcpy(buffer, data(), len + 1);
+            release();
+            m_heap.onHeap = true;
+            m_heap.size = len;
+            m_heap.capacity = newCapacity;
+            m_heap.data = buffer;
+        }
+
+        META_INLINE void assign(const char* s, size_t n)
+        {
+            if (n <= capacity())
+            {
+                std::memmove(mutableData(), s, n);
+                setSize(n);
+                return;
+            }
+
+            char* buffer = new char[n + 1];
+            std::memcpy(buffer, s, n);
+            buffer[n] = '\0';
+            release();
+            m_heap.onHeap = true;
+            m_heap.size = n;
+            m_heap.capacity = n;
+            m_heap.data = buffer;
+        }
+
+        META_INLINE void append(const char* s, size_t n)
+        {
+            size_t len = size();
+            if (len + n > capacity())
+                s = grow(len + n, s);
+            // The source never overlaps [len, len + n): it is either outside the string or within its content
+            std::memcpy(mutableData() + len, s, n);
+            setSize(len + n);
+        }
+
+        // Out of line so the common no-grow path of append stays small. s may point into our own content; the
+        // returned pointer finds it again at the same offset in the new buffer.
+        META_NOINLINE const char* grow(size_t needed, const char* s)
+        {
+            size_t len = size();
+            const char* old = data();
+            bool inside = std::less_equal<>()(old, s) && std::less<>()(s, old + len);
+            size_t offset = inside ? static_cast<size_t>(s - old) : 0;
+            reallocate(std::max(needed, capacity() * 2));
+            return inside ? data() + offset : s;
+        }
+
+        META_INLINE String<> concat(std::string_view rhs) const
+        {
+            String<> result;
+            result.reserve(size() + rhs.size());
+            result += std::string_view(*this);
+            result += rhs;
+            return result;
+        }
     };
 } // namespace meta
 
@@ -318,8 +462,7 @@ namespace std
     {
         size_t operator()(const meta::String<N>& s) const noexcept
         {
-            // Use std::hash<std::string_view> on your string data
-            return std::hash<std::string_view>{}(s);
+            return meta::hashString(s);
         }
     };
 } // namespace std
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/String.hpp>
+#include <string_view>
+#include <vector>
+
+namespace meta
+{
+    // Chunked string builder for large outputs.
+    // Text is appended into a list of arena chunks that never move once written, so growing the builder never copies
+    // what is already there. The chunks can be handed out as segments (e.g. for a gathered write) or flattened once.
+    class StringBuilder
+    {
+    public:
+        static constexpr size_t DefaultChunkSize = 4096;
+        static constexpr size_t MaxChunkSize = 1024 * 1024;
+
+        META_INLINE explicit StringBuilder(size_t chunkSize = DefaultChunkSize) noexcept
+            : m_nextChunkSize(std::max<size_t>(chunkSize, 64))
+        {
+        }
+
+        StringBuilder(const StringBuilder&) = delete;
+        StringBuilder& operator=(const StringBuilder&) = delete;
+        StringBuilder(StringBuilder&&) noexcept = default;
+        StringBuilder& operator=(StringBuilder&&) noexcept = default;
+
+        META_INLINE StringBuilder& append(std::string_view sv)
+        {
+            m_size += sv.size();
+            while (!sv.empty())
+            {
+                if (m_chunks.empty() || m_chunks.back().size == m_chunks.back().capacity)
+                    addChunk(sv.size());
+
+                Chunk& chunk = m_chunks.back();
+                size_t n = std::min(sv.size(), chunk.capacity - chunk.size);
+                std::memcpy(chunk.data.get() + chunk.size, sv.data(), n);
+                chunk.size += n;
+                sv.remove_prefix(n);
+            }
+            return *this;
+        }
+
+        META_INLINE StringBuilder& append(char c)
+        {
+            return append(std::string_view(&c, 1));
+        }
+
+        META_INLINE StringBuilder& operator+=(std::string_view sv)
+        {
+            return append(sv);
+        }
+
+        META_INLINE StringBuilder& operator+=(char c)
+        {
+            return append(c);
+        }
+
+        // Append each argument formatted as by meta::format
+        template <typename... Args> META_INLINE StringBuilder& appendFormat(const Args&... args)
+        {
+            (appendValue(args), ...);
+            return *this;
+        }
+
+        // Append a compile-time checked pattern, e.g. builder.appendFormat<"{}={}\n">(key, value)
+        template <FixedString Pattern, typename... Args> META_INLINE StringBuilder& appendFormat(const Args&... args)
+        {
+            meta::String<formatCapacity<Pattern, Args...>> text;
+            meta::formatTo<Pattern>(text, args...);
+            return append(std::string_view(text));
+        }
+
+        META_NODISCARD META_INLINE size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        META_NODISCARD META_INLINE bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        // Drops the content but keeps the first chunk for reuse
+        META_INLINE void clear() noexcept
+        {
+            if (m_chunks.size() > 1)
+                m_chunks.erase(m_chunks.begin() + 1, m_chunks.end());
+            if (!m_chunks.empty())
+                m_chunks.front().size = 0;
+            m_size = 0;
+        }
+
+        // Visit every written segment in order without copying
+        template <typename Func> META_INLINE void forEachSegment(Func&& func) const
+        {
+            for (const auto& chunk : m_chunks)
+                if (chunk.size > 0)
+                    func(std::string_view(chunk.data.get(), chunk.size));
+        }
+
+        // Flatten into a single contiguous string
+        META_NODISCARD META_INLINE String<> toString() const
+        {
+            String<> result;
+            result.reserve(m_size);
+            forEachSegment([&](std::string_view segment) { result += segment; });
+            return result;
+        }
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<char[]> data;
+            size_t size = 0;
+            size_t capacity = 0;
+        };
+
+        std::vector<Chunk> m_chunks;
+        size_t m_size = 0;
+        size_t m_nextChunkSize;
+
+        // Chunks double in size up to MaxChunkSize; a larger single append gets a chunk of its own size
+        META_INLINE void addChunk(size_t minCapacity)
+        {
+            size_t capacity = std::max(m_nextChunkSize, minCapacity);
+            m_chunks.push_back(Chunk{ std::make_unique_for_overwrite<char[]>(capacity), 0, capacity });
+            m_nextChunkSize = std::min(m_nextChunkSize * 2, MaxChunkSize);
+        }
+
+        template <typename T> META_INLINE void appendValue(const T& value)
+        {
+            if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            {
+                append(std::string_view(value));
+            }
+            else
+            {
+                meta::String<64> text;
+                meta::formatTo(text, value);
+                append(std::string_view(text));
+            }
+        }
+    };
+} // namespace meta
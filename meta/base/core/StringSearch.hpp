@@ -0,0 +1,432 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <meta/base/core/Platform.hpp>
+
+#if defined(META_ARCH_X64)
+#include <immintrin.h>
+#if defined(META_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+#endif
+
+// Byte search kernels shared by meta::String and friends.
+// Every routine works on a (pointer, length) range and returns an offset into it, or npos. On x86-64 the SSE2 or AVX2
+// kernel is picked once at runtime; other targets and short inputs use the scalar versions.
+namespace meta::search
+{
+    inline constexpr size_t npos = SIZE_MAX;
+
+    // Inputs shorter than this never leave the scalar path
+    inline constexpr size_t SimdThreshold = 16;
+
+    enum class SimdLevel
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    namespace scalar
+    {
+        META_INLINE size_t findChar(const char* s, size_t n, char c) noexcept
+        {
+            for (size_t i = 0; i < n; ++i)
+                if (s[i] == c)
+                    return i;
+            return npos;
+        }
+
+        META_INLINE size_t rfindChar(const char* s, size_t n, char c) noexcept
+        {
+            for (size_t i = n; i-- > 0;)
+                if (s[i] == c)
+                    return i;
+            return npos;
+        }
+
+        META_INLINE size_t countChar(const char* s, size_t n, char c) noexcept
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                count += s[i] == c;
+            return count;
+        }
+
+        META_INLINE size_t findFirstOf(const char* s, size_t n, const char* set, size_t m) noexcept
+        {
+            std::array<bool, 256> table{};
+            for (size_t j = 0; j < m; ++j)
+                table[static_cast<unsigned char>(set[j])] = true;
+            for (size_t i = 0; i < n; ++i)
+                if (table[static_cast<unsigned char>(s[i])])
+                    return i;
+            return npos;
+        }
+
+        // Candidate starts are [first, last]; the needle is at least two characters long
+        META_INLINE size_t findRange(const char* s, size_t first, size_t last, const char* p, size_t m) noexcept
+        {
+            for (size_t i = first; i <= last; ++i)
+                if (s[i] == p[0] && s[i + m - 1] == p[m - 1] && std::memcmp(s + i + 1, p + 1, m - 2) == 0)
+                    return i;
+            return npos;
+        }
+
+        // Candidate starts are [0, end) scanned backwards
+        META_INLINE size_t rfindRange(const char* s, size_t end, const char* p, size_t m) noexcept
+        {
+            for (size_t i = end; i-- > 0;)
+                if (s[i] == p[0] && s[i + m - 1] == p[m - 1] && std::memcmp(s + i + 1, p + 1, m - 2) == 0)
+                    return i;
+            return npos;
+        }
+
+        META_INLINE size_t find(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            return findRange(s, 0, n - m, p, m);
+        }
+
+        META_INLINE size_t rfind(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            return rfindRange(s, n - m + 1, p, m);
+        }
+    } // namespace scalar
+
+#if defined(META_ARCH_X64)
+    // Substring kernels compare the first and last needle character at every candidate start in a block and only
+    // memcmp the positions where both match.
+    namespace sse2
+    {
+        META_FORCE_INLINE uint32_t matchMask(const char* s, __m128i needle) noexcept
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        }
+
+        inline size_t rfindChar(const char* s, size_t n, char c) noexcept
+        {
+            const __m128i needle = _mm_set1_epi8(c);
+            size_t i = n;
+            while (i >= 16)
+            {
+                i -= 16;
+                if (uint32_t mask = matchMask(s + i, needle))
+                    return i + 31 - std::countl_zero(mask);
+            }
+            return scalar::rfindChar(s, i, c);
+        }
+
+        inline size_t countChar(const char* s, size_t n, char c) noexcept
+        {
+            const __m128i needle = _mm_set1_epi8(c);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+                count += std::popcount(matchMask(s + i, needle));
+            return count + scalar::countChar(s + i, n - i, c);
+        }
+
+        inline size_t findFirstOf(const char* s, size_t n, const char* set, size_t m) noexcept
+        {
+            __m128i needles[16];
+            for (size_t j = 0; j < m; ++j)
+                needles[j] = _mm_set1_epi8(set[j]);
+
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+                __m128i hits = _mm_setzero_si128();
+                for (size_t j = 0; j < m; ++j)
+                    hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needles[j]));
+                if (uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits)))
+                    return i + std::countr_zero(mask);
+            }
+            size_t pos = scalar::findFirstOf(s + i, n - i, set, m);
+            return pos == npos ? npos : i + pos;
+        }
+
+        META_FORCE_INLINE uint32_t candidateMask(const char* s, size_t m, __m128i first, __m128i last) noexcept
+        {
+            __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + m - 1));
+            __m128i hits = _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last));
+            return static_cast<uint32_t>(_mm_movemask_epi8(hits));
+        }
+
+        inline size_t find(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            const __m128i first = _mm_set1_epi8(p[0]);
+            const __m128i last = _mm_set1_epi8(p[m - 1]);
+            const size_t starts = n - m + 1;
+
+            size_t i = 0;
+            for (; i + 16 <= starts; i += 16)
+            {
+                for (uint32_t mask = candidateMask(s + i, m, first, last); mask; mask &= mask - 1)
+                {
+                    size_t pos = i + std::countr_zero(mask);
+                    if (std::memcmp(s + pos + 1, p + 1, m - 2) == 0)
+                        return pos;
+                }
+            }
+            return i < starts ? scalar::findRange(s, i, starts - 1, p, m) : npos;
+        }
+
+        inline size_t rfind(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            const __m128i first = _mm_set1_epi8(p[0]);
+            const __m128i last = _mm_set1_epi8(p[m - 1]);
+
+            size_t end = n - m + 1;
+            while (end >= 16)
+            {
+                size_t i = end - 16;
+                uint32_t mask = candidateMask(s + i, m, first, last);
+                while (mask)
+                {
+                    int bit = 31 - std::countl_zero(mask);
+                    if (std::memcmp(s + i + bit + 1, p + 1, m - 2) == 0)
+                        return i + bit;
+                    mask &= ~(1u << bit);
+                }
+                end = i;
+            }
+            return scalar::rfindRange(s, end, p, m);
+        }
+    } // namespace sse2
+
+    namespace avx2
+    {
+        META_TARGET_AVX2 META_FORCE_INLINE uint32_t matchMask(const char* s, __m256i needle) noexcept
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+        }
+
+        META_TARGET_AVX2 inline size_t rfindChar(const char* s, size_t n, char c) noexcept
+        {
+            const __m256i needle = _mm256_set1_epi8(c);
+            size_t i = n;
+            while (i >= 32)
+            {
+                i -= 32;
+                if (uint32_t mask = matchMask(s + i, needle))
+                    return i + 31 - std::countl_zero(mask);
+            }
+            return sse2::rfindChar(s, i, c);
+        }
+
+        META_TARGET_AVX2 inline size_t countChar(const char* s, size_t n, char c) noexcept
+        {
+            const __m256i needle = _mm256_set1_epi8(c);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32)
+                count += std::popcount(matchMask(s + i, needle));
+            return count + sse2::countChar(s + i, n - i, c);
+        }
+
+        META_TARGET_AVX2 inline size_t findFirstOf(const char* s, size_t n, const char* set, size_t m) noexcept
+        {
+            __m256i needles[16];
+            for (size_t j = 0; j < m; ++j)
+                needles[j] = _mm256_set1_epi8(set[j]);
+
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+                __m256i hits = _mm256_setzero_si256();
+                for (size_t j = 0; j < m; ++j)
+                    hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, needles[j]));
+                if (uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits)))
+                    return i + std::countr_zero(mask);
+            }
+            size_t pos = sse2::findFirstOf(s + i, n - i, set, m);
+            return pos == npos ? npos : i + pos;
+        }
+
+        META_TARGET_AVX2 META_FORCE_INLINE uint32_t candidateMask(const char* s, size_t m, __m256i first,
+                                                                  __m256i last) noexcept
+        {
+            __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+            __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + m - 1));
+            __m256i hits = _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last));
+            return static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+        }
+
+        META_TARGET_AVX2 inline size_t find(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            const __m256i first = _mm256_set1_epi8(p[0]);
+            const __m256i last = _mm256_set1_epi8(p[m - 1]);
+            const size_t starts = n - m + 1;
+
+            size_t i = 0;
+            for (; i + 32 <= starts; i += 32)
+            {
+                for (uint32_t mask = candidateMask(s + i, m, first, last); mask; mask &= mask - 1)
+                {
+                    size_t pos = i + std::countr_zero(mask);
+                    if (std::memcmp(s + pos + 1, p + 1, m - 2) == 0)
+                        return pos;
+                }
+            }
+            if (i >= starts)
+                return npos;
+            size_t pos = sse2::find(s + i, n - i, p, m);
+            return pos == npos ? npos : i + pos;
+        }
+
+        META_TARGET_AVX2 inline size_t rfind(const char* s, size_t n, const char* p, size_t m) noexcept
+        {
+            const __m256i first = _mm256_set1_epi8(p[0]);
+            const __m256i last = _mm256_set1_epi8(p[m - 1]);
+
+            size_t end = n - m + 1;
+            while (end >= 32)
+            {
+                size_t i = end - 32;
+                uint32_t mask = candidateMask(s + i, m, first, last);
+                while (mask)
+                {
+                    int bit = 31 - std::countl_zero(mask);
+                    if (std::memcmp(s + i + bit + 1, p + 1, m - 2) == 0)
+                        return i + bit;
+                    mask &= ~(1u << bit);
+                }
+                end = i;
+            }
+            return end > 0 ? sse2::rfind(s, end + m - 1, p, m) : npos;
+        }
+    } // namespace avx2
+#endif
+
+    META_INLINE SimdLevel detectSimdLevel() noexcept
+    {
+#if defined(META_ARCH_X64) && (defined(META_COMPILER_GCC) || defined(META_COMPILER_CLANG))
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#elif defined(META_ARCH_X64) && defined(META_COMPILER_MSVC)
+        int info[4];
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(info, 7, 0);
+        bool hasAvx2 = (info[1] & (1 << 5)) != 0;
+        return osSavesYmm && hasAvx2 ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    // Kernels chosen for the running CPU, resolved on first use
+    struct Kernels
+    {
+        size_t (*rfindChar)(const char*, size_t, char) noexcept;
+        size_t (*countChar)(const char*, size_t, char) noexcept;
+        size_t (*findFirstOf)(const char*, size_t, const char*, size_t) noexcept;
+        size_t (*find)(const char*, size_t, const char*, size_t) noexcept;
+        size_t (*rfind)(const char*, size_t, const char*, size_t) noexcept;
+    };
+
+    META_INLINE const Kernels& kernels() noexcept
+    {
+        static const Kernels selected = []() -> Kernels
+        {
+            switch (detectSimdLevel())
+            {
+#if defined(META_ARCH_X64)
+            case SimdLevel::AVX2:
+                return { avx2::rfindChar, avx2::countChar,
+                         avx2::findFirstOf, avx2::find, avx2::rfind };
+            case SimdLevel::SSE2:
+                return { sse2::rfindChar, sse2::countChar,
+                         sse2::findFirstOf, sse2::find, sse2::rfind };
+#endif
+            default:
+                return { scalar::rfindChar, scalar::countChar,
+                         scalar::findFirstOf, scalar::find, scalar::rfind };
+            }
+        }();
+        return selected;
+    }
+
+    // --- Dispatching entry points ---
+
+    // The C library's memchr is vectorized and unrolled further than a kernel of ours would be
+    // (examples/bench_string_search.cpp)
+    META_INLINE size_t findChar(const char* s, size_t n, char c) noexcept
+    {
+        if (n < SimdThreshold)
+            return scalar::findChar(s, n, c);
+        const void* found = std::memchr(s, c, n);
+        return found ? static_cast<size_t>(static_cast<const char*>(found) - s) : npos;
+    }
+
+    META_INLINE size_t rfindChar(const char* s, size_t n, char c) noexcept
+    {
+        return n < SimdThreshold ? scalar::rfindChar(s, n, c) : kernels().rfindChar(s, n, c);
+    }
+
+    META_INLINE size_t countChar(const char* s, size_t n, char c) noexcept
+    {
+        return n < SimdThreshold ? scalar::countChar(s, n, c) : kernels().countChar(s, n, c);
+    }
+
+    META_INLINE size_t findFirstOf(const char* s, size_t n, const char* set, size_t m) noexcept
+    {
+        if (m == 0)
+            return npos;
+        if (m == 1)
+            return findChar(s, n, set[0]);
+        // Larger sets are cheaper through the lookup table than through one compare per set character
+        if (n < SimdThreshold || m > 16)
+            return scalar::findFirstOf(s, n, set, m);
+        return kernels().findFirstOf(s, n, set, m);
+    }
+
+    META_INLINE size_t find(const char* s, size_t n, const char* p, size_t m) noexcept
+    {
+        if (m == 0)
+            return 0;
+        if (m > n)
+            return npos;
+        if (m == 1)
+            return findChar(s, n, p[0]);
+        return n < SimdThreshold ? scalar::find(s, n, p, m) : kernels().find(s, n, p, m);
+    }
+
+    META_INLINE size_t rfind(const char* s, size_t n, const char* p, size_t m) noexcept
+    {
+        if (m == 0)
+            return n;
+        if (m > n)
+            return npos;
+        if (m == 1)
+            return rfindChar(s, n, p[0]);
+        return n < SimdThreshold ? scalar::rfind(s, n, p, m) : kernels().rfind(s, n, p, m);
+    }
+
+    META_INLINE size_t count(const char* s, size_t n, const char* p, size_t m) noexcept
+    {
+        if (m == 0)
+            return 0;
+        if (m == 1)
+            return countChar(s, n, p[0]);
+
+        // Non-overlapping occurrences
+        size_t total = 0;
+        for (size_t pos = find(s, n, p, m); pos != npos; pos = find(s, n, p, m))
+        {
+            ++total;
+            s += pos + m;
+            n -= pos + m;
+        }
+        return total;
+    }
+} // namespace meta::search
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/core/StringSearch.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace meta
+{
+    // Non-owning view over characters owned by a String, Atom, literal or any other buffer.
+    // Mirrors the read-only String API; slicing (substr, trim, ...) returns another view and never copies.
+    class StringView
+    {
+    public:
+        static constexpr size_t npos = SIZE_MAX;
+
+        META_INLINE constexpr StringView() noexcept = default;
+
+        META_INLINE constexpr StringView(const char* s, size_t size) noexcept : m_data(s), m_size(size)
+        {
+        }
+
+        META_INLINE constexpr StringView(const char* s) noexcept : StringView(std::string_view(s))
+        {
+        }
+
+        META_INLINE constexpr StringView(std::string_view sv) noexcept : m_data(sv.data()), m_size(sv.size())
+        {
+        }
+
+        // Anything that exposes its text as a std::string_view (String<N>, std::string, Atom, ...)
+        template <typename T>
+            requires(std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, std::string_view> &&
+                     !std::is_convertible_v<const T&, const char*>)
+        META_INLINE constexpr StringView(const T& s) noexcept : StringView(std::string_view(s))
+        {
+        }
+
+        META_NODISCARD META_INLINE constexpr size_t size() const noexcept
+        {
+            return m_size;
+        }
+        META_NODISCARD META_INLINE constexpr bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+        META_NODISCARD META_INLINE constexpr const char* data() const noexcept
+        {
+            return m_data;
+        }
+        META_NODISCARD META_INLINE constexpr char operator[](size_t idx) const noexcept
+        {
+            return m_data[idx];
+        }
+        META_NODISCARD META_INLINE constexpr const char& front() const noexcept
+        {
+            return m_data[0];
+        }
+        META_NODISCARD META_INLINE constexpr const char& back() const noexcept
+        {
+            return m_data[m_size - 1];
+        }
+        META_NODISCARD META_INLINE constexpr const char* begin() const noexcept
+        {
+            return m_data;
+        }
+        META_NODISCARD META_INLINE constexpr const char* end() const noexcept
+        {
+            return m_data + m_size;
+        }
+        META_NODISCARD META_INLINE constexpr operator std::string_view() const noexcept
+        {
+            return std::string_view(m_data, m_size);
+        }
+        META_NODISCARD META_INLINE std::string toString() const
+        {
+            return std::string(m_data, m_size);
+        }
+
+        // --- Slicing ---
+
+        META_NODISCARD META_INLINE constexpr StringView substr(size_t pos, size_t len = npos) const noexcept
+        {
+            if (pos >= m_size)
+                return StringView();
+            return StringView(m_data + pos, std::min(len, m_size - pos));
+        }
+
+        META_NODISCARD META_INLINE StringView trim() const noexcept
+        {
+            return trimLeft().trimRight();
+        }
+
+        META_NODISCARD META_INLINE StringView trimLeft() const noexcept
+        {
+            size_t start = 0;
+            while (start < m_size && std::isspace(static_cast<unsigned char>(m_data[start])))
+                ++start;
+            return StringView(m_data + start, m_size - start);
+        }
+
+        META_NODISCARD META_INLINE StringView trimRight() const noexcept
+        {
+            size_t end = m_size;
+            while (end > 0 && std::isspace(static_cast<unsigned char>(m_data[end - 1])))
+                --end;
+            return StringView(m_data, end);
+        }
+
+        META_INLINE constexpr void removePrefix(size_t n) noexcept
+        {
+            n = std::min(n, m_size);
+            m_data += n;
+            m_size -= n;
+        }
+
+        META_INLINE constexpr void removeSuffix(size_t n) noexcept
+        {
+            m_size -= std::min(n, m_size);
+        }
+
+        // --- Search ---
+
+        META_NODISCARD META_INLINE size_t find(char c, size_t pos = 0) const noexcept
+        {
+            if (pos >= m_size)
+                return npos;
+            size_t found = search::findChar(m_data + pos, m_size - pos, c);
+            return found == npos ? npos : pos + found;
+        }
+
+        META_NODISCARD META_INLINE size_t find(StringView str, size_t pos = 0) const noexcept
+        {
+            if (pos > m_size)
+                return npos;
+            size_t found = search::find(m_data + pos, m_size - pos, str.data(), str.size());
+            return found == npos ? npos : pos + found;
+        }
+
+        META_NODISCARD META_INLINE size_t rfind(char c, size_t pos = npos) const noexcept
+        {
+            if (m_size == 0)
+                return npos;
+
+            size_t start = (pos == npos || pos >= m_size) ? m_size - 1 : pos;
+            return search::rfindChar(m_data, start + 1, c);
+        }
+
+        META_NODISCARD META_INLINE size_t rfind(StringView str, size_t pos = npos) const noexcept
+        {
+            if (str.empty() || m_size < str.size())
+                return npos;
+
+            size_t start = (pos == npos || pos >= m_size - str.size()) ? m_size - str.size() : pos;
+            return search::rfind(m_data, start + str.size(), str.data(), str.size());
+        }
+
+        META_NODISCARD META_INLINE size_t findFirstOf(StringView chars, size_t pos = 0) const noexcept
+        {
+            if (pos >= m_size)
+                return npos;
+            size_t found = search::findFirstOf(m_data + pos, m_size - pos, chars.data(), chars.size());
+            return found == npos ? npos : pos + found;
+        }
+
+        META_NODISCARD META_INLINE size_t count(char c) const noexcept
+        {
+            return search::countChar(m_data, m_size, c);
+        }
+
+        META_NODISCARD META_INLINE size_t count(StringView str) const noexcept
+        {
+            return search::count(m_data, m_size, str.data(), str.size());
+        }
+
+        META_NODISCARD META_INLINE bool contains(char c) const noexcept
+        {
+            return find(c) != npos;
+        }
+
+        META_NODISCARD META_INLINE bool contains(StringView str) const noexcept
+        {
+            return find(str) != npos;
+        }
+
+        META_NODISCARD META_INLINE bool startsWith(StringView prefix) const noexcept
+        {
+            return m_size >= prefix.size() && std::memcmp(m_data, prefix.data(), prefix.size()) == 0;
+        }
+
+        META_NODISCARD META_INLINE bool endsWith(StringView suffix) const noexcept
+        {
+            return m_size >= suffix.size() &&
+                   std::memcmp(m_data + m_size - suffix.size(), suffix.data(), suffix.size()) == 0;
+        }
+
+        // --- Comparison ---
+
+        META_NODISCARD META_INLINE int compare(StringView rhs) const noexcept
+        {
+            int result = std::memcmp(m_data, rhs.m_data, std::min(m_size, rhs.m_size));
+            if (result != 0)
+                return result;
+            return m_size < rhs.m_size ? -1 : (m_size > rhs.m_size ? 1 : 0);
+        }
+
+        friend bool operator==(StringView lhs, StringView rhs) noexcept
+        {
+            return lhs.m_size == rhs.m_size && std::memcmp(lhs.m_data, rhs.m_data, lhs.m_size) == 0;
+        }
+
+        friend std::strong_ordering operator<=>(StringView lhs, StringView rhs) noexcept
+        {
+            return lhs.compare(rhs) <=> 0;
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, StringView sv)
+        {
+            return os.write(sv.m_data, static_cast<std::streamsize>(sv.m_size));
+        }
+
+    private:
+        const char* m_data = "";
+        size_t m_size = 0;
+    };
+} // namespace meta
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <meta/base/core/Atom.hpp>
+#include <meta/base/core/Platform.hpp>
+#include <string_view>
+
+namespace meta
+{
+    namespace internal
+    {
+        struct ThreadInfo
+        {
+            uint32_t id = 0;
+            Atom name;
+        };
+
+        // Assigned on first use and cached for the lifetime of the thread
+        META_INLINE ThreadInfo& currentThreadInfo() noexcept
+        {
+            static std::atomic<uint32_t> nextId{ 1 };
+            thread_local ThreadInfo info{ nextId.fetch_add(1, std::memory_order_relaxed), {} };
+            return info;
+        }
+    } // namespace internal
+
+    // Small sequential id: 1 for the first thread that asks, then 2, 3, ... Never reused within a process.
+    META_NODISCARD META_INLINE uint32_t currentThreadId() noexcept
+    {
+        return internal::currentThreadInfo().id;
+    }
+
+    // Empty until setCurrentThreadName() is called on this thread
+    META_NODISCARD META_INLINE Atom currentThreadName() noexcept
+    {
+        return internal::currentThreadInfo().name;
+    }
+
+    // Names the calling thread, e.g. in log records. The name is interned, so prefer a fixed set such as "render".
+    META_INLINE void setCurrentThreadName(std::string_view name)
+    {
+        internal::currentThreadInfo().name = Atom(name);
+    }
+} // namespace meta
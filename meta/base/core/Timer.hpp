@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <meta/base/core/Clock.hpp>
 #include <meta/base/core/Platform.hpp>
 #include <string_view>
 
@@ -21,10 +22,12 @@ namespace meta
     {
     };
 
-    template <typename DurationTag = Milliseconds> class META_ALIGN(8) Timer
+    // Clock is steady_clock by default; TscClock (Clock.hpp) is cheaper to read on hot paths
+    template <typename DurationTag = Milliseconds, typename ClockType = std::chrono::steady_clock>
+    class META_ALIGN(8) Timer
     {
     public:
-        using Clock = std::chrono::high_resolution_clock;
+        using Clock = ClockType;
 
         META_INLINE Timer() noexcept
         {
@@ -53,9 +56,9 @@ namespace meta
         }
 
     private:
-        Clock::time_point m_start;
+        typename Clock::time_point m_start;
 
-        META_FORCE_INLINE constexpr double to_duration(std::chrono::high_resolution_clock::duration d) const noexcept
+        META_FORCE_INLINE constexpr double to_duration(typename Clock::duration d) const noexcept
         {
             if constexpr (std::is_same_v<DurationTag, Seconds>)
                 return std::chrono::duration<double>(d).count();
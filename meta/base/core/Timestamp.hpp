@@ -0,0 +1,108 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <meta/base/core/Platform.hpp>
+#include <string_view>
+
+namespace meta
+{
+    enum class TimestampPrecision
+    {
+        Seconds,      // 2024-05-01 12:34:56
+        Milliseconds, // 2024-05-01 12:34:56.789
+        Microseconds, // 2024-05-01 12:34:56.789012
+    };
+
+    // Formats wall-clock timestamps into a caller-provided buffer without allocating.
+    // The date and time of day are converted (localtime_r / gmtime_r) only when the second changes; within the
+    // same second only the fractional digits are rewritten. Not thread-safe: keep one per thread.
+    class TimestampCache
+    {
+    public:
+        static constexpr size_t MaxLength = 26; // "YYYY-MM-DD HH:MM:SS.uuuuuu"
+
+        // Writes the timestamp to out (at least MaxLength bytes) and returns its length
+        META_INLINE size_t format(char* out, std::chrono::system_clock::time_point now,
+                                  TimestampPrecision precision = TimestampPrecision::Seconds, bool utc = false)
+        {
+            auto sinceEpoch = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+            int64_t seconds = sinceEpoch / 1000000;
+            int64_t micros = sinceEpoch % 1000000;
+            if (micros < 0)
+            {
+                micros += 1000000;
+                --seconds;
+            }
+
+            if (seconds != m_second || utc != m_utc)
+                refresh(seconds, utc);
+
+            std::memcpy(out, m_prefix, PrefixLength);
+            switch (precision)
+            {
+            case TimestampPrecision::Milliseconds:
+                out[PrefixLength] = '.';
+                writeDigits(out + PrefixLength + 1, static_cast<uint32_t>(micros / 1000), 3);
+                return PrefixLength + 4;
+            case TimestampPrecision::Microseconds:
+                out[PrefixLength] = '.';
+                writeDigits(out + PrefixLength + 1, static_cast<uint32_t>(micros), 6);
+                return PrefixLength + 7;
+            default:
+                return PrefixLength;
+            }
+        }
+
+    private:
+        static constexpr size_t PrefixLength = 19; // "YYYY-MM-DD HH:MM:SS"
+
+        int64_t m_second = INT64_MIN;
+        bool m_utc = false;
+        char m_prefix[PrefixLength];
+
+        static META_INLINE void writeDigits(char* out, uint32_t value, int width) noexcept
+        {
+            for (int i = width - 1; i >= 0; --i)
+            {
+                out[i] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+        }
+
+        META_INLINE void refresh(int64_t seconds, bool utc)
+        {
+            auto timeT = static_cast<std::time_t>(seconds);
+            std::tm tm{};
+#if defined(META_PLATFORM_WINDOWS)
+            if (utc)
+                gmtime_s(&tm, &timeT);
+            else
+                localtime_s(&tm, &timeT);
+#else
+            if (utc)
+                gmtime_r(&timeT, &tm);
+            else
+                localtime_r(&timeT, &tm);
+#endif
+
+            writeDigits(m_prefix, static_cast<uint32_t>(tm.tm_year + 1900), 4);
+            m_prefix[4] = '-';
+            writeDigits(m_prefix + 5, static_cast<uint32_t>(tm.tm_mon + 1), 2);
+            m_prefix[7] = '-';
+            writeDigits(m_prefix + 8, static_cast<uint32_t>(tm.tm_mday), 2);
+            m_prefix[10] = ' ';
+            writeDigits(m_prefix + 11, static_cast<uint32_t>(tm.tm_hour), 2);
+            m_prefix[13] = ':';
+            writeDigits(m_prefix + 14, static_cast<uint32_t>(tm.tm_min), 2);
+            m_prefix[16] = ':';
+            writeDigits(m_prefix + 17, static_cast<uint32_t>(tm.tm_sec), 2);
+
+            m_second = seconds;
+            m_utc = utc;
+        }
+    };
+} // namespace meta
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <ios>
 #include <meta/base/core/String.hpp>
+#include <meta/base/core/StringBuilder.hpp>
 #include <meta/base/filesystem/Path.hpp>
 
 namespace meta
@@ -97,6 +98,16 @@ namespace meta
             m_stream.write(data.data(), data.size());
         }
 
+        // Writes every segment of the builder in order, without flattening it first
+        META_INLINE void write(const StringBuilder& builder)
+        {
+            if (!m_stream.is_open())
+                throw std::runtime_error("File not open for writing");
+
+            builder.forEachSegment([this](std::string_view segment)
+                                   { m_stream.write(segment.data(), static_cast<std::streamsize>(segment.size())); });
+        }
+
     private:
         std::fstream m_stream;
     };
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstddef>
+#include <meta/base/core/Platform.hpp>
+#include <meta/base/filesystem/Path.hpp>
+#include <stdexcept>
+#include <utility>
+
+#if defined(META_PLATFORM_WINDOWS)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace meta
+{
+    // File mapped into memory. Writes to a writable mapping reach the file through the page cache, so they survive a
+    // crash of the process (not of the machine) even without sync().
+    class MappedFile
+    {
+    public:
+        enum class Mode
+        {
+            Read,      // map an existing file read-only
+            ReadWrite, // create or resize the file to the requested size and map it writable
+        };
+
+        META_INLINE MappedFile() = default;
+
+        MappedFile(const Path& path, Mode mode, size_t size = 0)
+        {
+            open(path, mode, size);
+        }
+
+        ~MappedFile()
+        {
+            close();
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                std::swap(m_data, other.m_data);
+                std::swap(m_size, other.m_size);
+#if defined(META_PLATFORM_WINDOWS)
+                std::swap(m_file, other.m_file);
+                std::swap(m_mapping, other.m_mapping);
+#else
+                std::swap(m_fd, other.m_fd);
+#endif
+            }
+            return *this;
+        }
+
+        void open(const Path& path, Mode mode, size_t size = 0)
+        {
+            close();
+            bool writable = mode == Mode::ReadWrite;
+
+#if defined(META_PLATFORM_WINDOWS)
+            m_file = CreateFileA(path.c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (m_file == INVALID_HANDLE_VALUE)
+                throw std::runtime_error("Failed to open file: " + path.toString());
+
+            if (!writable)
+            {
+                LARGE_INTEGER fileSize{};
+                GetFileSizeEx(m_file, &fileSize);
+                size = static_cast<size_t>(fileSize.QuadPart);
+            }
+            if (size == 0)
+                return;
+
+            LARGE_INTEGER mapSize{};
+            mapSize.QuadPart = static_cast<LONGLONG>(size);
+            m_mapping = CreateFileMappingA(m_file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                           static_cast<DWORD>(mapSize.HighPart), mapSize.LowPart, nullptr);
+            if (!m_mapping)
+            {
+                close();
+                throw std::runtime_error("Failed to map file: " + path.toString());
+            }
+
+            m_data = static_cast<char*>(MapViewOfFile(m_mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size));
+#else
+            m_fd = ::open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+            if (m_fd < 0)
+                throw std::runtime_error("Failed to open file: " + path.toString());
+
+            if (writable)
+            {
+                if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+                {
+                    close();
+                    throw std::runtime_error("Failed to resize file: " + path.toString());
+                }
+            }
+            else
+            {
+                struct stat info{};
+                ::fstat(m_fd, &info);
+                size = static_cast<size_t>(info.st_size);
+            }
+            if (size == 0)
+                return;
+
+            void* data = ::mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, m_fd, 0);
+            m_data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+#endif
+            if (!m_data)
+            {
+                close();
+                throw std::runtime_error("Failed to map file: " + path.toString());
+            }
+            m_size = size;
+        }
+
+        void close() noexcept
+        {
+#if defined(META_PLATFORM_WINDOWS)
+            if (m_data)
+                UnmapViewOfFile(m_data);
+            if (m_mapping)
+                CloseHandle(m_mapping);
+            if (m_file != INVALID_HANDLE_VALUE)
+                CloseHandle(m_file);
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+#else
+            if (m_data)
+                ::munmap(m_data, m_size);
+            if (m_fd >= 0)
+                ::close(m_fd);
+            m_fd = -1;
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        // Schedules dirty pages to be written to disk without waiting for them
+        void sync() noexcept
+        {
+            if (!m_data)
+                return;
+#if defined(META_PLATFORM_WINDOWS)
+            FlushViewOfFile(m_data, m_size);
+#else
+            ::msync(m_data, m_size, MS_ASYNC);
+#endif
+        }
+
+        META_NODISCARD META_INLINE bool isOpen() const noexcept
+        {
+            return m_data != nullptr;
+        }
+
+        META_NODISCARD META_INLINE char* data() noexcept
+        {
+            return m_data;
+        }
+
+        META_NODISCARD META_INLINE const char* data() const noexcept
+        {
+            return m_data;
+        }
+
+        META_NODISCARD META_INLINE size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+    private:
+        char* m_data = nullptr;
+        size_t m_size = 0;
+#if defined(META_PLATFORM_WINDOWS)
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+} // namespace meta
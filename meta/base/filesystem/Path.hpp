@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <meta/base/core/Format.hpp>
+#include <meta/base/core/Hash.hpp>
 #include <meta/base/core/String.hpp>
 
 namespace meta
@@ -11,37 +15,45 @@ namespace meta
     public:
         META_INLINE Path() = default;
 
-        META_INLINE Path(const String<>& str) : m_path(normalizeSeparators(str))
+        META_INLINE Path(const String<>& str) : m_path(normalizeSeparators(str.view()))
         {
         }
-        META_INLINE Path(String<>&& str) : m_path(normalizeSeparators(std::move(str)))
+        META_INLINE Path(const char* s) : m_path(normalizeSeparators(StringView(s)))
         {
         }
-        META_INLINE Path(const char* s) : m_path(normalizeSeparators(String<>(s)))
+        META_INLINE Path(std::string_view sv) : m_path(normalizeSeparators(StringView(sv)))
         {
         }
-        META_INLINE Path(std::string_view sv) : m_path(normalizeSeparators(String<>(sv)))
+        META_INLINE Path(StringView sv) : m_path(normalizeSeparators(sv))
         {
         }
 
-        META_INLINE Path(const Path& other) : m_path(other.m_path)
+        META_INLINE Path(const Path& other) : m_path(other.m_path), m_hash(other.m_hash.load(std::memory_order_relaxed))
         {
         }
-        META_INLINE Path(Path&& other) noexcept : m_path(std::move(other.m_path))
+        META_INLINE Path(Path&& other) noexcept
+            : m_path(std::move(other.m_path)), m_hash(other.m_hash.load(std::memory_order_relaxed))
         {
+            other.m_hash.store(0, std::memory_order_relaxed);
         }
 
         META_INLINE Path& operator=(const Path& other)
         {
             if (this != &other)
+            {
                 m_path = other.m_path;
+                m_hash.store(other.m_hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
             return *this;
         }
 
         META_INLINE Path& operator=(Path&& other) noexcept
         {
             if (this != &other)
+            {
                 m_path = std::move(other.m_path);
+                m_hash.store(other.m_hash.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            }
             return *this;
         }
 
@@ -64,39 +76,58 @@ namespace meta
 
         META_NODISCARD META_INLINE String<> filename() const
         {
-            size_t pos = m_path.rfind('/');
-#ifdef _WIN32
-            if (pos == String<>::npos)
-                pos = m_path.rfind('\\');
-#endif
+            return String<>(filenameView());
+        }
+
+        // View of the last component; valid while this Path is alive and unmodified
+        META_NODISCARD META_INLINE StringView filenameView() const noexcept
+        {
+            size_t pos = lastSeparator();
             if (pos == String<>::npos)
-                return m_path;
-            return m_path.substr(pos + 1);
+                return m_path.view();
+            return m_path.substrView(pos + 1);
         }
 
         META_NODISCARD META_INLINE Path parentPath() const
         {
-            size_t pos = m_path.rfind('/');
-#ifdef _WIN32
-            if (pos == String<>::npos)
-                pos = m_path.rfind('\\');
-#endif
+            size_t pos = lastSeparator();
             if (pos == String<>::npos)
                 return Path("");
-            return Path(m_path.substr(0, pos));
+            return Path(m_path.substrView(0, pos));
         }
 
         META_NODISCARD META_INLINE String<> extension() const
         {
-            String<> file = filename();
+            return String<>(extensionView());
+        }
+
+        META_NODISCARD META_INLINE StringView extensionView() const noexcept
+        {
+            StringView file = filenameView();
             size_t pos = file.rfind('.');
-            if (pos == String<>::npos)
-                return "";
+            if (pos == StringView::npos)
+                return StringView();
             return file.substr(pos);
         }
 
+        // Same value as hashString(str()); computed on first use and cached, since a Path is never modified in place
+        META_NODISCARD META_INLINE size_t hash() const noexcept
+        {
+            size_t h = m_hash.load(std::memory_order_relaxed);
+            if (h == 0)
+            {
+                h = hashString(m_path);
+                m_hash.store(h, std::memory_order_relaxed);
+            }
+            return h;
+        }
+
         META_INLINE bool operator==(const Path& rhs) const noexcept
         {
+            size_t lhsHash = m_hash.load(std::memory_order_relaxed);
+            size_t rhsHash = rhs.m_hash.load(std::memory_order_relaxed);
+            if (lhsHash != 0 && rhsHash != 0 && lhsHash != rhsHash)
+                return false;
             return m_path == rhs.m_path;
         }
         META_INLINE bool operator!=(const Path& rhs) const noexcept
@@ -116,38 +147,51 @@ namespace meta
 
     private:
         String<> m_path;
+        mutable std::atomic<size_t> m_hash{ 0 }; // 0 = not computed yet
 
-        // Build a new string with separators normalized for the current platform
-        static META_INLINE String<> normalizeSeparators(const String<>& input)
+        META_INLINE size_t lastSeparator() const noexcept
         {
-            String<> result;
-            result.reserve(input.size());
-            for (size_t i = 0; i < input.size(); ++i)
-            {
-#ifdef META_PLATFORM_WINDOWS
-                char c = (input[i] == '/' || input[i] == '\\') ? '\\' : input[i];
-#else
-                char c = (input[i] == '/' || input[i] == '\\') ? '/' : input[i];
+            size_t pos = m_path.rfind('/');
+#ifdef _WIN32
+            if (pos == String<>::npos)
+                pos = m_path.rfind('\\');
 #endif
-                result += c;
-            }
-            return result;
+            return pos;
         }
 
-        static META_INLINE String<> normalizeSeparators(String<>&& input)
+        // Build a new string with separators normalized for the current platform
+        static META_INLINE String<> normalizeSeparators(StringView input)
         {
             String<> result;
             result.reserve(input.size());
-            for (size_t i = 0; i < input.size(); ++i)
+            for (char c : input)
             {
 #ifdef META_PLATFORM_WINDOWS
-                char c = (input[i] == '/' || input[i] == '\\') ? '\\' : input[i];
+                result += (c == '/' || c == '\\') ? '\\' : c;
 #else
-                char c = (input[i] == '/' || input[i] == '\\') ? '/' : input[i];
+                result += (c == '/' || c == '\\') ? '/' : c;
 #endif
-                result += c;
             }
             return result;
         }
     };
+
+    template <> struct Formatter<Path>
+    {
+        template <size_t N> static META_INLINE void format(String<N>& out, const Path& path)
+        {
+            out += std::string_view(path.str());
+        }
+    };
 } // namespace meta
+
+namespace std
+{
+    template <> struct hash<meta::Path>
+    {
+        size_t operator()(const meta::Path& path) const noexcept
+        {
+            return path.hash();
+        }
+    };
+} // namespace std
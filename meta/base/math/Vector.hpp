@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <meta/base/core/Format.hpp>
 #include <meta/base/core/Platform.hpp>
 #include <meta/base/math/Constants.hpp>
 
@@ -273,7 +274,7 @@ namespace meta::Math
         }
         META_INLINE constexpr Vector4D operator-(const Vector4D& rhs) const noexcept
         {
-            return { x - rhs.x, y - rhs.y, z - rhs.z, w - wrhs.w };
+            return { x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w };
         }
         META_INLINE constexpr Vector4D operator*(T scalar) const noexcept
         {
@@ -353,3 +354,36 @@ namespace meta::Math
         }
     };
 } // namespace meta::Math
+
+namespace meta
+{
+    template <typename T> struct Formatter<Math::Vector2D<T>>
+    {
+        static constexpr size_t maxSize = 2 * internal::formatSizeHint<T>() + 4;
+
+        template <size_t N> static META_INLINE void format(String<N>& out, const Math::Vector2D<T>& v)
+        {
+            formatTo(out, "(", v.x, ", ", v.y, ")");
+        }
+    };
+
+    template <typename T> struct Formatter<Math::Vector3D<T>>
+    {
+        static constexpr size_t maxSize = 3 * internal::formatSizeHint<T>() + 6;
+
+        template <size_t N> static META_INLINE void format(String<N>& out, const Math::Vector3D<T>& v)
+        {
+            formatTo(out, "(", v.x, ", ", v.y, ", ", v.z, ")");
+        }
+    };
+
+    template <typename T> struct Formatter<Math::Vector4D<T>>
+    {
+        static constexpr size_t maxSize = 4 * internal::formatSizeHint<T>() + 8;
+
+        template <size_t N> static META_INLINE void format(String<N>& out, const Math::Vector4D<T>& v)
+        {
+            formatTo(out, "(", v.x, ", ", v.y, ", ", v.z, ", ", v.w, ")");
+        }
+    };
+} // namespace meta
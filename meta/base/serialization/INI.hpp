@@ -1,7 +1,10 @@
 #pragma once
 
+#include <meta/base/core/Atom.hpp>
 #include <meta/base/core/Format.hpp>
+#include <meta/base/core/Split.hpp>
 #include <meta/base/core/String.hpp>
+#include <meta/base/core/StringBuilder.hpp>
 #include <meta/base/filesystem/File.hpp>
 #include <sstream>
 #include <unordered_map>
@@ -11,8 +14,9 @@ namespace meta
     class INI
     {
     public:
-        using Section = std::unordered_map<meta::String<>, meta::String<>>;
-        using Data = std::unordered_map<meta::String<>, Section>;
+        // Keyed by interned names; lookups by plain text work too (transparent hash) and don't intern anything
+        using Section = std::unordered_map<meta::Atom, meta::String<>, meta::AtomHash, std::equal_to<>>;
+        using Data = std::unordered_map<meta::Atom, Section, meta::AtomHash, std::equal_to<>>;
 
         INI() = default;
 
@@ -36,17 +40,17 @@ namespace meta
             try
             {
                 meta::File file(filepath, meta::File::Mode::Write);
-                meta::String<> content;
+                meta::StringBuilder content;
 
                 for (const auto& [section, kv] : m_data)
                 {
                     if (!section.empty())
-                        content += meta::format("[", section, "]\n");
+                        content.appendFormat("[", section, "]\n");
 
                     for (const auto& [key, value] : kv)
-                        content += meta::format(key, "=", value, "\n");
+                        content.appendFormat(key, "=", value, "\n");
 
-                    content += "\n";
+                    content += '\n';
                 }
 
                 file.write(content);
@@ -58,40 +62,35 @@ namespace meta
             }
         }
 
-        template <typename T> void set(const meta::String<>& section, const meta::String<>& key, const T& value)
+        template <typename T> void set(const meta::Atom& section, const meta::Atom& key, const T& value)
         {
             m_data[section][key] = meta::format(value);
         }
 
+        template <typename T> void set(std::string_view section, std::string_view key, const T& value)
+        {
+            set(meta::Atom(section), meta::Atom(key), value);
+        }
+
         template <typename T>
-        T get(const meta::String<>& section, const meta::String<>& key, const T& defaultValue = {}) const
+        T get(const meta::Atom& section, const meta::Atom& key, const T& defaultValue = {}) const
         {
-            auto secIt = m_data.find(section);
-            if (secIt != m_data.end())
-            {
-                auto keyIt = secIt->second.find(key);
-                if (keyIt != secIt->second.end())
-                {
-                    if constexpr (std::is_same_v<T, meta::String<>>)
-                    {
-                        return keyIt->second;
-                    }
-                    else
-                    {
-                        std::istringstream iss(keyIt->second.toString());
-                        T result{};
-                        if (iss >> result)
-                            return result;
-                    }
-                }
-            }
-            return defaultValue;
+            return convert(find(section, key), defaultValue);
         }
 
-        bool has(const meta::String<>& section, const meta::String<>& key) const
+        template <typename T> T get(std::string_view section, std::string_view key, const T& defaultValue = {}) const
         {
-            auto secIt = m_data.find(section);
-            return secIt != m_data.end() && secIt->second.find(key) != secIt->second.end();
+            return convert(find(section, key), defaultValue);
+        }
+
+        bool has(const meta::Atom& section, const meta::Atom& key) const
+        {
+            return find(section, key) != nullptr;
+        }
+
+        bool has(std::string_view section, std::string_view key) const
+        {
+            return find(section, key) != nullptr;
         }
 
         void clear()
@@ -99,40 +98,65 @@ namespace meta
             m_data.clear();
         }
 
-    private:
+        // Replaces the settings with those in content, in the same format load() reads
         void parse(const meta::String<>& content)
         {
             m_data.clear();
-            meta::String<> currentSection;
-
-            std::istringstream iss(content.toString());
-            std::string rawLine;
+            meta::Atom currentSection;
 
-            while (std::getline(iss, rawLine))
+            for (meta::StringView rawLine : meta::lines(content))
             {
-                meta::String<> line(rawLine); // convert std::string to meta::String
-                line.trim();
+                meta::StringView line = rawLine.trim();
 
                 if (line.empty() || line[0] == ';' || line[0] == '#')
                     continue;
 
                 if (line.front() == '[' && line.back() == ']')
                 {
-                    currentSection = line.substr(1, line.size() - 2).trim();
+                    currentSection = meta::Atom(line.substr(1, line.size() - 2).trim());
                 }
                 else
                 {
-                    auto eqPos = line.rfind('=');
-                    if (eqPos != meta::String<>::npos)
+                    auto eqPos = line.find('=');
+                    if (eqPos != meta::StringView::npos)
                     {
-                        meta::String<> key = line.substr(0, eqPos).trim();
-                        meta::String<> value = line.substr(eqPos + 1).trim();
-                        m_data[currentSection][key] = value;
+                        meta::StringView key = line.substr(0, eqPos).trim();
+                        meta::StringView value = line.substr(eqPos + 1).trim();
+                        m_data[currentSection][meta::Atom(key)] = meta::String<>(value);
                     }
                 }
             }
         }
 
+    private:
+        template <typename Key> const meta::String<>* find(const Key& section, const Key& key) const
+        {
+            auto secIt = m_data.find(section);
+            if (secIt == m_data.end())
+                return nullptr;
+            auto keyIt = secIt->second.find(key);
+            return keyIt != secIt->second.end() ? &keyIt->second : nullptr;
+        }
+
+        template <typename T> static T convert(const meta::String<>* value, const T& defaultValue)
+        {
+            if (value)
+            {
+                if constexpr (std::is_same_v<T, meta::String<>>)
+                {
+                    return *value;
+                }
+                else
+                {
+                    std::istringstream iss(value->toString());
+                    T result{};
+                    if (iss >> result)
+                        return result;
+                }
+            }
+            return defaultValue;
+        }
+
         Data m_data;
     };
 } // namespace meta::serialization
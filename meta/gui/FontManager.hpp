@@ -1,5 +1,6 @@
 #pragma once
 #include <SDL_ttf.h>
+#include <meta/base/core/Atom.hpp>
 #include <meta/base/core/Console.hpp>
 #include <meta/base/filesystem/Path.hpp>
 #include <unordered_map>
@@ -17,6 +18,12 @@ namespace meta::gui
 
         // Load font by Path and size, cached to avoid reopening multiple times
         TTF_Font* loadFont(const Path& path, int size)
+        {
+            return loadFont(meta::Atom(path.str()), size);
+        }
+
+        // Cache lookups only hash and compare the interned path id and the size
+        TTF_Font* loadFont(const meta::Atom& path, int size)
         {
             if (path.empty())
             {
@@ -24,7 +31,7 @@ namespace meta::gui
                 return nullptr;
             }
 
-            std::string key = path.toString() + "#" + std::to_string(size);
+            FontKey key{ path, size };
             auto it = m_fonts.find(key);
             if (it != m_fonts.end())
                 return it->second;
@@ -64,6 +71,24 @@ namespace meta::gui
         FontManager(const FontManager&) = delete;
         FontManager& operator=(const FontManager&) = delete;
 
-        std::unordered_map<std::string, TTF_Font*> m_fonts;
+        struct FontKey
+        {
+            meta::Atom path;
+            int size;
+
+            bool operator==(const FontKey&) const = default;
+        };
+
+        struct FontKeyHash
+        {
+            size_t operator()(const FontKey& key) const noexcept
+            {
+                // The path hash is cached in the atom; mixing in the size costs one multiply
+                return static_cast<size_t>(internal::wyMix(key.path.hash() ^ internal::WySecret[0],
+                                                           static_cast<uint64_t>(key.size) ^ internal::WySecret[1]));
+            }
+        };
+
+        std::unordered_map<FontKey, TTF_Font*, FontKeyHash> m_fonts;
     };
 } // namespace meta::gui
@@ -147,7 +147,7 @@ namespace meta::gui
         {
             if (!theme.fontPath.empty())
             {
-                m_font = FontManager::instance().loadFont(theme.fontPath.c_str(), theme.fontSize);
+                m_font = FontManager::instance().loadFont(theme.fontPath, theme.fontSize);
                 if (!m_font)
                     meta::errorln("Failed to load font from FontManager!");
             }
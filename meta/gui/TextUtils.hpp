@@ -23,30 +23,33 @@ namespace meta::gui::utils
         if (!font || text.empty())
             return lines;
 
-        meta::String<> currentLine;
+        // Lines are sliced out of text; the scratch copy only exists because SDL_ttf wants a terminated string
+        meta::String<> measured;
+        size_t lineStart = 0;
 
         for (size_t i = 0; i < text.size(); ++i)
         {
             char c = text[i];
-            currentLine += c;
+            measured += c;
 
             int w = 0;
-            TTF_SizeText(font, currentLine.c_str(), &w, nullptr);
+            TTF_SizeText(font, measured.c_str(), &w, nullptr);
 
             if (w > maxWidth || c == '\n')
             {
-                if (w > maxWidth && c != '\n')
-                    currentLine.popBack();
+                bool overflow = w > maxWidth && c != '\n';
+                size_t lineEnd = overflow ? i : i + 1;
+                lines.emplace_back(text.substrView(lineStart, lineEnd - lineStart));
 
-                lines.push_back(currentLine);
-                currentLine = meta::String<>();
-                if (c != '\n')
-                    currentLine += c;
+                lineStart = lineEnd;
+                measured = meta::String<>();
+                if (overflow)
+                    measured += c;
             }
         }
 
-        if (!currentLine.empty())
-            lines.push_back(currentLine);
+        if (lineStart < text.size())
+            lines.emplace_back(text.substrView(lineStart));
 
         return lines;
     }
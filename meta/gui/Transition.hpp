@@ -1,4 +1,5 @@
 #pragma once
+#include <meta/base/core/Clock.hpp>
 #include <meta/base/core/Platform.hpp>
 #include <meta/base/core/Timer.hpp>
 
@@ -60,7 +61,7 @@ namespace meta::gui
         float m_end;
         float m_duration; // seconds
         bool m_active = false;
-        meta::Timer<meta::Milliseconds> m_timer;
+        meta::Timer<meta::Milliseconds, meta::TscClock> m_timer; // read every frame by every animated widget
 
         // Smoothstep easing
         META_FORCE_INLINE static float easeInOut(float t)
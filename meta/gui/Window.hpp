@@ -3,6 +3,9 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <memory>
+#include <meta/base/core/Clock.hpp>
+#include <meta/base/core/EventLoop.hpp>
+#include <meta/base/core/ScopeTimer.hpp>
 #include <meta/gui/layouts/Layout.hpp>
 #include <meta/gui/Theme.hpp>
 #include <meta/gui/widgets/Widget.hpp>
@@ -16,6 +19,9 @@ namespace meta::gui
         Window(const meta::String<>& title, int w, int h)
             : m_width(w), m_height(h), m_initialWidth(w), m_initialHeight(h), m_title(title)
         {
+            // Transitions time themselves with TscClock; measure its rate while SDL starts up, off this thread
+            meta::TscClock::calibrateInBackground();
+
             SDL_Init(SDL_INIT_VIDEO);
 
             m_window = SDL_CreateWindow(title.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, w, h,
@@ -58,6 +64,12 @@ namespace meta::gui
             return m_renderer;
         }
 
+        // Tasks and queued signal connections that run on the GUI thread; drained once per frame
+        meta::EventLoop& eventLoop()
+        {
+            return m_eventLoop;
+        }
+
         void setTitle(const meta::String<>& title)
         {
             m_title = title;
@@ -106,12 +118,17 @@ namespace meta::gui
             float scaleX = static_cast<float>(m_width) / m_initialWidth;
             float scaleY = static_cast<float>(m_height) / m_initialHeight;
 
-            m_layout->updateLayout(0, 0, m_width, m_height, scaleX, scaleY);
+            {
+                META_PROFILE_SCOPE("layout");
+                m_layout->updateLayout(0, 0, m_width, m_height, scaleX, scaleY);
+            }
+            META_PROFILE_SCOPE("render");
             renderLayoutRecursive(m_layout, scaleX, scaleY);
         }
 
         void pollEvents(bool& running)
         {
+            META_PROFILE_SCOPE("event-poll");
             SDL_Event e;
             while (SDL_PollEvent(&e))
             {
@@ -127,6 +144,8 @@ namespace meta::gui
                 if (m_layout)
                     handleLayoutEventsRecursive(m_layout, e);
             }
+
+            m_eventLoop.drain();
         }
 
         void handleEvent(const SDL_Event& e)
@@ -135,6 +154,8 @@ namespace meta::gui
                 m_layout->handleEvent(e);
         }
 
+        // Runs frames until the window is closed. With META_PROFILER each frame records its event-poll, update,
+        // layout, render and present phases and collects the profiler once it ends.
         template <typename Func> void run(Func perFrame)
         {
             bool running = true;
@@ -142,37 +163,61 @@ namespace meta::gui
 
             while (running)
             {
-                while (SDL_PollEvent(&e))
                 {
-                    if (e.type == SDL_QUIT)
-                        running = false;
-
-                    if (e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+                    META_PROFILE_SCOPE("frame");
                     {
-                        m_width = e.window.data1;
-                        m_height = e.window.data2;
+                        META_PROFILE_SCOPE("event-poll");
+                        while (SDL_PollEvent(&e))
+                        {
+                            if (e.type == SDL_QUIT)
+                                running = false;
+
+                            if (e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+                            {
+                                m_width = e.window.data1;
+                                m_height = e.window.data2;
+                            }
+
+                            if (m_layout)
+                                m_layout->handleEvent(e);
+                        }
+
+                        m_eventLoop.drain();
                     }
 
-                    if (m_layout)
-                        m_layout->handleEvent(e);
-                }
+                    {
+                        META_PROFILE_SCOPE("update");
+                        perFrame(running);
+                    }
 
-                perFrame(running);
+                    float scaleX = static_cast<float>(m_width) / m_initialWidth;
+                    float scaleY = static_cast<float>(m_height) / m_initialHeight;
 
-                float scaleX = static_cast<float>(m_width) / m_initialWidth;
-                float scaleY = static_cast<float>(m_height) / m_initialHeight;
+                    {
+                        META_PROFILE_SCOPE("layout");
+                        if (m_layout)
+                            m_layout->updateLayout(0, 0, m_width, m_height, scaleX, scaleY);
+                    }
 
-                if (m_layout)
-                    m_layout->updateLayout(0, 0, m_width, m_height, scaleX, scaleY);
+                    {
+                        META_PROFILE_SCOPE("render");
+                        SDL_SetRenderDrawColor(m_renderer, m_theme->backgroundColor.r, m_theme->backgroundColor.g,
+                                               m_theme->backgroundColor.b, m_theme->backgroundColor.a);
+                        SDL_RenderClear(m_renderer);
 
-                SDL_SetRenderDrawColor(m_renderer, m_theme->backgroundColor.r, m_theme->backgroundColor.g,
-                                       m_theme->backgroundColor.b, m_theme->backgroundColor.a);
-                SDL_RenderClear(m_renderer);
+                        if (m_layout)
+                            m_layout->render(m_renderer);
+                    }
 
-                if (m_layout)
-                    m_layout->render(m_renderer);
+                    {
+                        META_PROFILE_SCOPE("present");
+                        SDL_RenderPresent(m_renderer);
+                    }
+                }
 
-                SDL_RenderPresent(m_renderer);
+#if META_PROFILER
+                meta::Profiler::instance().collect();
+#endif
             }
         }
 
@@ -214,5 +259,6 @@ namespace meta::gui
         std::vector<Widget*> m_widgets;
         std::shared_ptr<Layout> m_layout;
         std::shared_ptr<Theme> m_theme;
+        meta::EventLoop m_eventLoop;
     };
 } // namespace meta::gui
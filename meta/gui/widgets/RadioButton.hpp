@@ -139,7 +139,7 @@ namespace meta::gui
         {
             if (m_theme && !m_theme->fontPath.empty())
             {
-                m_font = FontManager::instance().loadFont(m_theme->fontPath.c_str(), m_theme->fontSize);
+                m_font = FontManager::instance().loadFont(m_theme->fontPath, m_theme->fontSize);
                 if (!m_font)
                     meta::errorln("Failed to load font from FontManager!");
             }
@@ -18,7 +18,7 @@ namespace meta::gui
             : Widget(DEFAULT_THEME.minWidth, DEFAULT_THEME.minHeight, DEFAULT_THEME.minWidth, DEFAULT_THEME.minHeight),
               m_label(label), m_text(initialText)
         {
-            m_font = FontManager::instance().loadFont(DEFAULT_THEME.fontPath.c_str(), DEFAULT_THEME.fontSize);
+            m_font = FontManager::instance().loadFont(DEFAULT_THEME.fontPath, DEFAULT_THEME.fontSize);
             if (!m_font)
                 meta::errorln("Failed to load font from FontManager!");
         }
@@ -30,7 +30,7 @@ namespace meta::gui
         {
             m_theme = theme;
             if (m_theme && !m_theme->fontPath.empty())
-                m_font = FontManager::instance().loadFont(m_theme->fontPath.c_str(), m_theme->fontSize);
+                m_font = FontManager::instance().loadFont(m_theme->fontPath, m_theme->fontSize);
         }
 
         void setText(const meta::String<>& text)
@@ -18,7 +18,7 @@ namespace meta::gui
               m_knobTransition(initialState ? 1.0f : 0.0f, initialState ? 1.0f : 0.0f, 0.15f)
         {
             if (!m_label.empty())
-                m_font = FontManager::instance().loadFont(DEFAULT_THEME.fontPath.c_str(), DEFAULT_THEME.fontSize);
+                m_font = FontManager::instance().loadFont(DEFAULT_THEME.fontPath, DEFAULT_THEME.fontSize);
         }
 
         // Signal for toggle state changes
@@ -28,7 +28,7 @@ namespace meta::gui
         {
             m_theme = theme;
             if (!m_label.empty() && m_theme && !m_theme->fontPath.empty())
-                m_font = FontManager::instance().loadFont(m_theme->fontPath.c_str(), m_theme->fontSize);
+                m_font = FontManager::instance().loadFont(m_theme->fontPath, m_theme->fontSize);
         }
 
         void setState(bool state)
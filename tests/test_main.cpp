@@ -1,4 +1,205 @@
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <meta/base/app/Logger.hpp>
+#include <meta/base/core/ConcurrentSignal.hpp>
+#include <meta/base/core/Console.hpp>
+#include <meta/base/core/EventLoop.hpp>
+#include <meta/base/core/Signal.hpp>
+#include <meta/base/core/ThreadInfo.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t LinesPerThread = 50000;
+
+    struct Record
+    {
+        uint64_t sequence;
+        uint32_t threadId;
+        std::string text;
+    };
+
+    // Parses "[worker-<t>] [INFO] line <i> of worker <t>\n"; false if the line is torn or mixed with another one
+    bool parseLine(std::string_view line, size_t& worker, size_t& index)
+    {
+        auto number = [&](std::string_view prefix, size_t& value)
+        {
+            if (!line.starts_with(prefix))
+                return false;
+            line.remove_prefix(prefix.size());
+            auto [end, error] = std::from_chars(line.data(), line.data() + line.size(), value);
+            if (error != std::errc{})
+                return false;
+            line.remove_prefix(static_cast<size_t>(end - line.data()));
+            return true;
+        };
+
+        size_t named = 0, suffix = 0;
+        return number("[worker-", named) && number("] [INFO] line ", index) && number(" of worker ", suffix) &&
+               line == "\n" && named == suffix && (worker = named, true);
+    }
+
+    // Logs LinesPerThread lines from each of threadCount threads into a file and a capturing sink, then checks that
+    // every line arrived whole, exactly once, with gap-free sequence numbers and in each thread's own order
+    bool stressLogger(size_t threadCount, bool async)
+    {
+        const std::filesystem::path file =
+            std::filesystem::temp_directory_path() / ("meta_logger_stress_" + std::to_string(threadCount) + ".log");
+        std::filesystem::remove(file);
+
+        std::vector<Record> records;
+        records.reserve(threadCount * LinesPerThread);
+
+        double seconds = 0.0;
+        {
+            meta::Logger logger;
+            logger.clearSinks();
+            logger.includeThreadNames(true);
+            logger.setFile(meta::Path(std::string_view(file.string())));
+            logger.addSink(std::make_shared<meta::CallbackSink>(
+                [&](const meta::LogMessage& message)
+                { records.push_back({ message.sequence, message.threadId, std::string(message.text.view()) }); }));
+            if (async)
+                logger.enableAsync();
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < threadCount; ++t)
+                threads.emplace_back(
+                    [&logger, t]
+                    {
+                        meta::setCurrentThreadName("worker-" + std::to_string(t));
+                        for (size_t i = 0; i < LinesPerThread; ++i)
+                            logger.info("line ", i, " of worker ", t);
+                    });
+            for (auto& thread : threads)
+                thread.join();
+            logger.flush();
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        const char* mode = async ? "async" : "sync";
+        auto fail = [&](std::string_view what)
+        {
+            meta::errorln("logger stress (", mode, ", ", threadCount, " threads): ", what);
+            return false;
+        };
+
+        size_t total = threadCount * LinesPerThread;
+        if (records.size() != total)
+            return fail("sink saw the wrong number of records");
+
+        // Sequence numbers are 1..total, and each thread's lines appear in the order it logged them
+        std::sort(records.begin(), records.end(),
+                  [](const Record& a, const Record& b) { return a.sequence < b.sequence; });
+        std::vector<size_t> nextIndex(threadCount, 0);
+        std::vector<uint32_t> threadIds(threadCount, 0);
+        for (size_t i = 0; i < total; ++i)
+        {
+            size_t worker = 0, index = 0;
+            if (records[i].sequence != i + 1)
+                return fail("sequence numbers are not unique and gap-free");
+            if (!parseLine(records[i].text, worker, index) || worker >= threadCount)
+                return fail("record text is malformed");
+            if (index != nextIndex[worker]++)
+                return fail("a thread's records are out of order");
+            if (threadIds[worker] == 0)
+                threadIds[worker] = records[i].threadId;
+            else if (threadIds[worker] != records[i].threadId)
+                return fail("a thread's records carry different thread ids");
+        }
+
+        // The file holds every line whole
+        std::vector<size_t> fileLines(threadCount, 0);
+        std::ifstream in(file, std::ios::binary);
+        std::string line;
+        size_t lineCount = 0;
+        while (std::getline(in, line))
+        {
+            size_t worker = 0, index = 0;
+            line += '\n';
+            if (!parseLine(line, worker, index) || worker >= threadCount || index != fileLines[worker]++)
+                return fail("file output is interleaved");
+            ++lineCount;
+        }
+        in.close();
+        std::filesystem::remove(file);
+        if (lineCount != total)
+            return fail("file is missing lines");
+
+        meta::println<"logger stress ({}, {} threads): {} lines in {} ms, {} lines/s">(
+            mode, threadCount, total, static_cast<int64_t>(seconds * 1000.0), static_cast<int64_t>(total / seconds));
+        return true;
+    }
+
+    // A queued call posted by an emit() that is still running on another thread must not run once disconnect() has
+    // returned, even though that emit() keeps the old slot list (and the forwarder) alive
+    bool queuedCallAfterDisconnect()
+    {
+        meta::EventLoop loop;
+        meta::ConcurrentSignal<int> signal;
+        int calls = 0;
+        auto queued = signal.connect([&](int) { ++calls; }, loop);
+
+        std::atomic<int> phase{ 0 };
+        signal.connect(
+            [&](int)
+            {
+                phase.store(1);
+                while (phase.load() != 2)
+                    std::this_thread::yield();
+            });
+
+        std::thread emitter([&] { signal.emit(1); });
+        while (phase.load() != 1)
+            std::this_thread::yield();
+        queued.disconnect();
+        loop.drain();
+        phase.store(2);
+        emitter.join();
+        loop.drain();
+
+        if (calls != 0)
+        {
+            meta::errorln("queued slot ran ", calls, " times after disconnect");
+            return false;
+        }
+        return true;
+    }
+
+    // A slot may destroy the signal that is calling it, e.g. a dialog whose close handler resets its owner
+    bool signalDestroyedBySlot()
+    {
+        auto signal = std::make_unique<meta::Signal<int>>();
+        int calls = 0;
+        signal->connect([&](int) { signal.reset(); });
+        signal->connect([&](int value) { calls += value; });
+        signal->emit(1);
+
+        if (signal || calls != 1)
+        {
+            meta::errorln("signal destroyed by its slot: ", calls, " later slot calls, expected 1");
+            return false;
+        }
+        return true;
+    }
+} // namespace
+
 int main()
 {
-    return 0;
+    bool ok = queuedCallAfterDisconnect();
+    ok = signalDestroyedBySlot() && ok;
+    for (bool async : { false, true })
+        for (size_t threads : { 1, 2, 4, 8 })
+            ok = stressLogger(threads, async) && ok;
+    return ok ? 0 : 1;
 }